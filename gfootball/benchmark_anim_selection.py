@@ -0,0 +1,62 @@
+# coding=utf-8
+# Copyright 2019 Google LLC
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+"""Micro-benchmark of the engine's animation selection.
+
+Records animation selection queries of a played match and replays them through
+the indexed and the reference (linear scan) selection, checking that both
+select exactly the same animations.
+
+The engine has to be built with recording of the queries enabled
+(cmake -DBENCHMARK_HOOKS=ON).
+"""
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+from absl import app
+from absl import flags
+
+from gfootball.env import config
+import gfootball_engine as libgame
+
+FLAGS = flags.FLAGS
+
+flags.DEFINE_string('level', '11_vs_11_stochastic', 'Level to record')
+flags.DEFINE_integer('steps', 300, 'Number of environment steps to record')
+flags.DEFINE_integer('repeats', 10, 'How many times to replay the queries')
+
+
+def main(_):
+  cfg = config.Config({
+      'level': FLAGS.level,
+      'players': ['agent:left_players=1'],
+  })
+  env = libgame.GameEnv()
+  env.start_game(cfg.GameConfig())
+  env.reset(cfg.ScenarioConfig())
+  # The agent stays idle, all the other players are controlled by the game AI.
+  result = env.benchmark_anim_selection(FLAGS.steps, FLAGS.repeats)
+  print('Queries: %d, mismatches: %d' % (result['queries'],
+                                         result['mismatches']))
+  print('Linear: %.1f ms, indexed: %.1f ms' % (result['linear_ms'],
+                                               result['indexed_ms']))
+  if result['mismatches']:
+    exit(1)
+
+
+if __name__ == '__main__':
+  app.run(main)
@@ -0,0 +1,61 @@
+# coding=utf-8
+# Copyright 2019 Google LLC
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+"""Micro-benchmark of the engine's time to ball calculation.
+
+Records the time to ball calculations of both teams during a played match and
+repeats them with the batched and the reference (per player) implementation,
+checking that both give exactly the same times.
+
+The engine has to be built with recording of the queries enabled
+(cmake -DBENCHMARK_HOOKS=ON).
+"""
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+from absl import app
+from absl import flags
+
+from gfootball.env import config
+import gfootball_engine as libgame
+
+FLAGS = flags.FLAGS
+
+flags.DEFINE_string('level', '11_vs_11_stochastic', 'Level to record')
+flags.DEFINE_integer('steps', 300, 'Number of environment steps to record')
+flags.DEFINE_integer('repeats', 10, 'How many times to repeat the calculations')
+
+
+def main(_):
+  cfg = config.Config({
+      'level': FLAGS.level,
+      'players': ['agent:left_players=1'],
+  })
+  env = libgame.GameEnv()
+  env.start_game(cfg.GameConfig())
+  env.reset(cfg.ScenarioConfig())
+  result = env.benchmark_time_to_ball(FLAGS.steps, FLAGS.repeats)
+  print('Team calculations: %d, players: %d, mismatches: %d' %
+        (result['queries'], result['players'], result['mismatches']))
+  print('Reference: %.1f ms, batched: %.1f ms' % (result['reference_ms'],
+                                                  result['batched_ms']))
+  if result['mismatches']:
+    exit(1)
+
+
+if __name__ == '__main__':
+  app.run(main)
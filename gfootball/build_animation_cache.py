@@ -0,0 +1,59 @@
+# coding=utf-8
+# Copyright 2019 Google LLC
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+"""Builds the binary animation cache of the game engine.
+
+Loads and prepares all the animations from their sources and writes them to a
+binary file, which the engine reads at startup instead of preparing the
+animations again. The cache records the engine code version and a hash of the
+animation sources, so a stale cache is ignored (and the sources are used
+instead).
+"""
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import time
+
+from absl import app
+from absl import flags
+
+from gfootball.env import config
+import gfootball_engine as libgame
+
+FLAGS = flags.FLAGS
+
+flags.DEFINE_string('output', 'media/animations/animations.cache',
+                    'Cache file, relative to the engine data directory. '
+                    'The engine only uses the default one.')
+
+
+def main(_):
+  cfg = config.Config()
+  game_config = cfg.GameConfig()
+  # Always prepare the animations from their sources.
+  game_config.use_animation_cache = False
+  start = time.time()
+  env = libgame.GameEnv()
+  env.start_game(game_config)
+  env.reset(cfg.ScenarioConfig())
+  print('Animations prepared in %.1f s' % (time.time() - start))
+  env.write_animation_cache(FLAGS.output)
+  print('Written to %s' % FLAGS.output)
+
+
+if __name__ == '__main__':
+  app.run(main)
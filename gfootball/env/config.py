@@ -109,9 +109,13 @@ class Config(object):
         'game_difficulty': 0.6,
         'players': ['agent:left_players=1'],
         'level': '11_vs_11_stochastic',
+        'native_smm': False,
+        'physics_only': False,
         'physics_steps_per_frame': 10,
         'real_time': False,
         'render': False,
+        'render_resolution_x': 1280,
+        'render_resolution_y': 720,
         'tracesdir': '/tmp/dumps',
         'write_video': False
     }
@@ -165,7 +169,10 @@ class Config(object):
     cfg.render_mode = libgame.e_RenderingMode.e_Onscreen if self[
         'render'] else libgame.e_RenderingMode.e_Disabled
     cfg.high_quality = self['render']
+    cfg.physics_only = self['physics_only']
     cfg.physics_steps_per_frame = self['physics_steps_per_frame']
+    cfg.render_resolution_x = self['render_resolution_x']
+    cfg.render_resolution_y = self['render_resolution_y']
     return cfg
 
   def ScenarioConfig(self):
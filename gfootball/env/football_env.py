@@ -187,6 +187,21 @@ class FootballEnv(gym.Env):
     self.last_observation = observation
     return observation
 
+  def smm(self, channel_dimensions):
+    """Returns Super Mini Map of the agent's players, rasterized by the engine.
+
+    Equal to observation_preprocessing.generate_smm of the agent's last
+    observation.
+    """
+    frame = self._env.smm(channel_dimensions)
+    left_agents = sum(
+        [player.num_controlled_left_players() for player in self._players])
+    left = self._agent_left_position
+    right = left_agents + self._agent_right_position
+    return np.concatenate([
+        frame[left:left + self._agent.num_controlled_left_players()],
+        frame[right:right + self._agent.num_controlled_right_players()]])
+
   def write_dump(self, name):
     return self._env.write_dump(name)
 
@@ -25,11 +25,14 @@ import gfootball_engine as libgame
 from gfootball.env import config as cfg
 from gfootball.env import constants
 from gfootball.env import football_action_set
+from gfootball.env import observation_buffer
+from gfootball.env import observation_preprocessing
 import numpy as np
 from six.moves import range
 import timeit
 
-_unused_engines = []
+# Engines which are not rendering, by their 'physics_only' setting.
+_unused_engines = {False: [], True: []}
 _unused_rendering_engine = None
 _active_rendering = False
 
@@ -50,7 +53,6 @@ class FootballEnvCore(object):
     self._step = 0
     self._trace = trace
     self._observation = None
-    self._info = None
     self._done = False
     self._config.NewScenario()
     self._scenario_cfg = self._config.ScenarioConfig()
@@ -61,13 +63,17 @@ class FootballEnvCore(object):
           _unused_rendering_engine = None
           self.rendering_in_use()
       else:
-        if _unused_engines:
-          self._env = _unused_engines.pop()
+        engines = _unused_engines[self._config['physics_only']]
+        if engines:
+          self._env = engines.pop()
       if not self._env:
         if self._config['render']:
           self.rendering_in_use()
         self._env = libgame.GameEnv()
         self._env.start_game(self._config.GameConfig())
+    # Updated in place by the engine, so it has to be copied from.
+    self._raw_observation = observation_buffer.view(
+        self._env.get_observation_buffer())[0]
     self._left_controllers = []
     self._right_controllers = []
     for _ in range(self._scenario_cfg.left_agents):
@@ -97,7 +103,7 @@ class FootballEnvCore(object):
         _unused_rendering_engine = self._env
         _active_rendering = False
       else:
-        _unused_engines.append(self._env)
+        _unused_engines[self._config['physics_only']].append(self._env)
       self._env = None
 
   def __del__(self):
@@ -203,66 +209,61 @@ class FootballEnvCore(object):
     Returns whether game
        is on or not.
     """
-    info = self._env.get_info()
-    if info.done:
+    info = self._raw_observation
+    if info['done']:
       self._done = True
     result = {}
     if self._config['render']:
-      frame = self._env.get_frame()
-      frame = np.frombuffer(frame, dtype=np.uint8)
-      frame = np.reshape(frame, [1280, 720, 3])
-      frame = np.reshape(
-          np.concatenate([frame[:, :, 0], frame[:, :, 1], frame[:, :, 2]]),
-          [3, 720, 1280])
-      frame = np.transpose(frame, [1, 2, 0])
-      frame = np.flip(frame, 0)
-      result['frame'] = frame
-    result['ball'] = np.array(
-        [info.ball_position[0], info.ball_position[1], info.ball_position[2]])
+      # Engine reuses the frame buffer, so it has to be copied.
+      frame = np.frombuffer(self._env.get_frame(), dtype=np.uint8)
+      result['frame'] = np.reshape(frame, [
+          self._config['render_resolution_y'],
+          self._config['render_resolution_x'], 3
+      ]).copy()
+    result['ball'] = info['ball_position'].astype(np.float64)
     # Ball's movement direction represented as [x, y] distance per step.
-    result['ball_direction'] = np.array([
-        info.ball_direction[0], info.ball_direction[1], info.ball_direction[2]
-    ])
+    result['ball_direction'] = info['ball_direction'].astype(np.float64)
     # Ball's rotation represented as [x, y, z] rotation angle per step.
-    result['ball_rotation'] = np.array(
-        [info.ball_rotation[0], info.ball_rotation[1], info.ball_rotation[2]])
+    result['ball_rotation'] = info['ball_rotation'].astype(np.float64)
 
-    self.convert_players_observation(info.left_team, 'left_team', result)
-    self.convert_players_observation(info.right_team, 'right_team', result)
+    self.convert_players_observation(
+        info['left_team'][:int(info['left_team_size'])], 'left_team', result)
+    self.convert_players_observation(
+        info['right_team'][:int(info['right_team_size'])], 'right_team',
+        result)
     result['left_agent_sticky_actions'] = []
     result['left_agent_controlled_player'] = []
     result['right_agent_sticky_actions'] = []
     result['right_agent_controlled_player'] = []
     for i in range(self._scenario_cfg.left_agents):
-      if i >= len(info.left_controllers):
+      if i >= len(self._scenario_cfg.left_team):
         result['left_agent_controlled_player'].append(-1)
         result['left_agent_sticky_actions'].append(
             np.zeros((len(football_action_set.get_sticky_actions(
                 self._config))), dtype=np.uint8))
         continue
       result['left_agent_controlled_player'].append(
-          info.left_controllers[i].controlled_player)
+          int(info['left_controlled_player'][i]))
       result['left_agent_sticky_actions'].append(np.array(
           self._left_controllers[i].active_sticky_actions(), dtype=np.uint8))
     for i in range(self._scenario_cfg.right_agents):
-      if i >= len(info.right_controllers):
+      if i >= len(self._scenario_cfg.right_team):
         result['right_agent_controlled_player'].append(-1)
         result['right_agent_sticky_actions'].append(
             np.zeros((len(football_action_set.get_sticky_actions(
                 self._config))), dtype=np.uint8))
         continue
       result['right_agent_controlled_player'].append(
-          info.right_controllers[i].controlled_player)
+          int(info['right_controlled_player'][i]))
       result['right_agent_sticky_actions'].append(np.array(
           self._right_controllers[i].active_sticky_actions(), dtype=np.uint8))
-    result['game_mode'] = int(info.game_mode)
-    result['score'] = [info.left_goals, info.right_goals]
-    result['ball_owned_team'] = info.ball_owned_team
-    result['ball_owned_player'] = info.ball_owned_player
+    result['game_mode'] = int(info['game_mode'])
+    result['score'] = [int(info['left_goals']), int(info['right_goals'])]
+    result['ball_owned_team'] = int(info['ball_owned_team'])
+    result['ball_owned_player'] = int(info['ball_owned_player'])
     result['steps_left'] = self._config['game_duration'] - self._step
     self._observation = result
-    self._info = info
-    return info.is_in_play
+    return bool(info['is_in_play'])
 
   def convert_players_observation(self, players, name, result):
     """Converts internal players representation to the public one.
@@ -271,40 +272,33 @@ class FootballEnvCore(object):
        Public representation is part of environment observations.
 
     Args:
-      players: collection of team players to convert.
+      players: array of team players (observation_buffer.PLAYER_DTYPE).
       name: name of the team being converted (left_team or right_team).
       result: collection where conversion result is added.
     """
-    positions = []
-    directions = []
-    tired_factors = []
-    active = []
-    yellow_cards = []
-    roles = []
-    for player in players:
-      positions.append(player.position[0])
-      positions.append(player.position[1])
-      directions.append(player.direction[0])
-      directions.append(player.direction[1])
-      tired_factors.append(player.tired_factor)
-      active.append(player.is_active)
-      yellow_cards.append(player.has_card)
-      roles.append(player.role)
-    result[name] = np.reshape(np.array(positions), [-1, 2])
+    result[name] = players['position'].astype(np.float64)
     # Players' movement direction represented as [x, y] distance per step.
-    result['{}_direction'.format(name)] = np.reshape(
-        np.array(directions), [-1, 2])
+    result['{}_direction'.format(name)] = players['direction'].astype(
+        np.float64)
     # Players' tired factor in the range [0, 1] (0 means not tired).
-    result['{}_tired_factor'.format(name)] = np.array(tired_factors)
-    result['{}_active'.format(name)] = np.array(active)
-    result['{}_yellow_card'.format(name)] = np.array(yellow_cards)
-    result['{}_roles'.format(name)] = np.array(roles)
+    result['{}_tired_factor'.format(name)] = players['tired_factor'].astype(
+        np.float64)
+    result['{}_active'.format(name)] = players['is_active'] != 0
+    result['{}_yellow_card'.format(name)] = players['has_card'] != 0
+    result['{}_roles'.format(name)] = players['role'].astype(np.int64)
 
   @cfg.log
   def observation(self):
     """Returns the current observation of the game."""
     return copy.deepcopy(self._observation)
 
+  def smm(self, channel_dimensions):
+    """Returns Super Mini Map of all the controlled players of the game."""
+    return observation_preprocessing.generate_native_smm(
+        self._env,
+        self._scenario_cfg.left_agents + self._scenario_cfg.right_agents,
+        self._config, channel_dimensions)
+
   def perform_action(self, action):
     # Left team player 0 action...
     self._env.perform_action(action, self._left_team, self._player_id)
@@ -88,5 +88,8 @@ class FootballEnvWrapper(object):
   def observation(self):
     return self._env.observation()
 
+  def smm(self, channel_dimensions):
+    return self._env.smm(channel_dimensions)
+
   def close(self):
     self._env.close()
@@ -0,0 +1,78 @@
+# coding=utf-8
+# Copyright 2019 Google LLC
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+"""Numpy view of the raw observation buffer written by the game engine.
+
+Layout has to match RawObservation from the engine's defines.hpp.
+"""
+
+from __future__ import print_function
+
+import numpy as np
+
+# Maximal number of players per team.
+MAX_PLAYERS = 11
+
+PLAYER_DTYPE = np.dtype([
+    ('position', np.float32, (2,)),
+    ('direction', np.float32, (2,)),
+    ('tired_factor', np.float32),
+    ('has_card', np.float32),
+    ('is_active', np.float32),
+    ('role', np.float32),
+])
+
+OBSERVATION_DTYPE = np.dtype([
+    ('ball_position', np.float32, (3,)),
+    ('ball_direction', np.float32, (3,)),
+    ('ball_rotation', np.float32, (3,)),
+    ('ball_owned_team', np.float32),
+    ('ball_owned_player', np.float32),
+    ('left_team_size', np.float32),
+    ('right_team_size', np.float32),
+    ('left_team', PLAYER_DTYPE, (MAX_PLAYERS,)),
+    ('right_team', PLAYER_DTYPE, (MAX_PLAYERS,)),
+    ('left_controlled_player', np.float32, (MAX_PLAYERS,)),
+    ('right_controlled_player', np.float32, (MAX_PLAYERS,)),
+    ('left_goals', np.float32),
+    ('right_goals', np.float32),
+    ('game_mode', np.float32),
+    ('is_in_play', np.float32),
+    ('done', np.float32),
+])
+
+# Number of float fields of a single observation.
+OBSERVATION_FIELDS = OBSERVATION_DTYPE.itemsize // 4
+
+
+def view(buffer):
+  """Returns structured array (one element per environment) over the buffer.
+
+  No data is copied, so the view reflects each subsequent engine step.
+
+  Args:
+    buffer: result of GameEnv / GameEnvBatch get_observation_buffer().
+  """
+  assert len(buffer) % OBSERVATION_DTYPE.itemsize == 0, (
+      'Observation layout does not match the game engine.')
+  return np.frombuffer(buffer, dtype=OBSERVATION_DTYPE)
+
+
+def flat_view(buffer):
+  """Returns [environments x OBSERVATION_FIELDS] float32 view of the buffer."""
+  assert len(buffer) % OBSERVATION_DTYPE.itemsize == 0, (
+      'Observation layout does not match the game engine.')
+  return np.frombuffer(buffer, dtype=np.float32).reshape(
+      [-1, OBSERVATION_FIELDS])
@@ -94,3 +94,24 @@ def generate_smm(observation, config=None,
       else:
         mark_points(frame[o_i, :, :, index], np.array(o[layer]).reshape(-1))
   return frame
+
+
+def generate_native_smm(engine, agents, config=None,
+                        channel_dimensions=(SMM_WIDTH, SMM_HEIGHT)):
+  """Same as generate_smm, rasterized by the game engine itself.
+
+  Args:
+    engine: libgame.GameEnv to rasterize the current observation of
+    agents: number of players controlled by all the agents of the game
+    config: environment config
+    channel_dimensions: resolution of SMM to generate
+
+  Returns:
+    (N, H, W, C) - shaped np array representing SMM, for the players controlled
+    on the left team followed by the ones controlled on the right team.
+  """
+  frame = np.zeros((agents, channel_dimensions[1], channel_dimensions[0],
+                    len(get_smm_layers(config))), dtype=np.uint8)
+  engine.get_smm(frame, channel_dimensions[0], channel_dimensions[1], 1,
+                 bool(config and config['enable_sides_swap']))
+  return frame
@@ -0,0 +1,62 @@
+# coding=utf-8
+# Copyright 2019 Google LLC
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+"""Tests of the engine's physics-only mode."""
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import random
+import unittest
+
+from gfootball.env import config
+from gfootball.env import football_action_set
+import gfootball_engine as libgame
+
+
+class PhysicsOnlyTest(unittest.TestCase):
+
+  def test_same_trajectories_as_regular_engine(self):
+    cfg = config.Config({
+        'level': '11_vs_11_stochastic',
+        'players': ['agent:left_players=1'],
+    })
+    envs = []
+    for physics_only in [False, True]:
+      game_config = cfg.GameConfig()
+      game_config.render_mode = libgame.e_RenderingMode.e_Disabled
+      game_config.physics_only = physics_only
+      env = libgame.GameEnv()
+      env.start_game(game_config)
+      envs.append(env)
+    actions = football_action_set.get_action_set(cfg)
+    rng = random.Random(0)
+    for episode in range(2):
+      cfg.NewScenario()
+      for env in envs:
+        env.reset(cfg.ScenarioConfig())
+      for step in range(200):
+        action = rng.choice(actions)._backend_action
+        for env in envs:
+          env.perform_action(action, True, 0)
+          env.step()
+        self.assertEqual(bytes(envs[0].get_observation_buffer()),
+                         bytes(envs[1].get_observation_buffer()),
+                         'diverged in episode %d, step %d' % (episode, step))
+
+
+if __name__ == '__main__':
+  unittest.main()
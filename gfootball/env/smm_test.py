@@ -0,0 +1,71 @@
+# coding=utf-8
+# Copyright 2019 Google LLC
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+"""Tests of the engine's Super Mini Map rasterizer."""
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import random
+import unittest
+
+from gfootball.env import config
+from gfootball.env import football_env
+from gfootball.env import observation_preprocessing
+from gfootball.env import wrappers
+import numpy as np
+
+
+class SmmTest(unittest.TestCase):
+
+  def _check(self, values, channel_dimensions, episodes=1, steps=100):
+    values.update({'level': '11_vs_11_stochastic', 'native_smm': True})
+    cfg = config.Config(values)
+    env = wrappers.SMMWrapper(football_env.FootballEnv(cfg),
+                              channel_dimensions)
+    rng = random.Random(0)
+    for _ in range(episodes):
+      env.reset()
+      for _ in range(steps):
+        actions = [rng.randrange(env.action_space.nvec[0])
+                   for _ in range(len(env.action_space.nvec))]
+        smm, _, done, _ = env.step(actions)
+        expected = observation_preprocessing.generate_smm(
+            env.unwrapped.last_observation, config=cfg,
+            channel_dimensions=channel_dimensions)
+        self.assertEqual(smm.shape, env.observation_space.shape)
+        np.testing.assert_array_equal(smm, expected)
+        if done:
+          break
+    env.close()
+
+  def test_left_agents(self):
+    self._check({'players': ['agent:left_players=2']},
+                (observation_preprocessing.SMM_WIDTH,
+                 observation_preprocessing.SMM_HEIGHT))
+
+  def test_both_teams_with_sides_swap(self):
+    self._check({'players': ['agent:left_players=2,right_players=1'],
+                 'enable_sides_swap': True}, (40, 30), episodes=4, steps=50)
+
+  def test_agent_after_other_players(self):
+    self._check({'players': ['keyboard:left_players=1',
+                             'agent:left_players=1,right_players=1']},
+                (96, 72))
+
+
+if __name__ == '__main__':
+  unittest.main()
@@ -0,0 +1,101 @@
+# coding=utf-8
+# Copyright 2019 Google LLC
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+"""Tests of the engine's save_state / restore_state."""
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import random
+import unittest
+
+from gfootball.env import config
+from gfootball.env import football_action_set
+from gfootball.env import observation_buffer
+import gfootball_engine as libgame
+
+
+class StateTest(unittest.TestCase):
+
+  def _start(self, level, seed=None):
+    values = {
+        'level': level,
+        'players': ['agent:left_players=1'],
+    }
+    if seed is not None:
+      values['game_engine_random_seed'] = seed
+    cfg = config.Config(values)
+    game_config = cfg.GameConfig()
+    game_config.render_mode = libgame.e_RenderingMode.e_Disabled
+    env = libgame.GameEnv()
+    env.start_game(game_config)
+    env.reset(cfg.ScenarioConfig())
+    return env, football_action_set.get_action_set(cfg)
+
+  def _play(self, env, actions, steps, seed):
+    """Plays random actions, returns the observation after each step."""
+    rng = random.Random(seed)
+    observations = []
+    for _ in range(steps):
+      env.perform_action(rng.choice(actions)._backend_action, True, 0)
+      env.step()
+      observations.append(bytes(env.get_observation_buffer()))
+    return observations
+
+  def test_restore_replays_trajectory(self):
+    env, actions = self._start('11_vs_11_stochastic')
+    self._play(env, actions, 50, seed=0)
+    state = env.save_state()
+    expected = self._play(env, actions, 100, seed=1)
+    env.restore_state(state)
+    self.assertEqual(self._play(env, actions, 100, seed=1), expected)
+
+  def test_restore_is_repeatable(self):
+    env, actions = self._start('11_vs_11_stochastic')
+    state = env.save_state()
+    expected = self._play(env, actions, 100, seed=2)
+    for _ in range(2):
+      env.restore_state(state)
+      self.assertEqual(self._play(env, actions, 100, seed=2), expected)
+
+  def test_restore_brings_back_sent_off_player(self):
+    # With this seed, a player gets sent off at step 239 when the agent keeps
+    # on sliding.
+    env, _ = self._start('11_vs_11_stochastic', seed=5604)
+    state = env.save_state()
+    actions = [football_action_set.action_sliding,
+               football_action_set.action_pressure]
+
+    def play():
+      rng = random.Random(5604)
+      observations = []
+      for _ in range(300):
+        action = actions[0] if rng.random() < 0.5 else actions[1]
+        env.perform_action(action._backend_action, True, 0)
+        env.step()
+        observations.append(bytes(env.get_observation_buffer()))
+      return observations
+
+    expected = play()
+    observation = observation_buffer.view(env.get_observation_buffer())[0]
+    self.assertLess(observation['left_team']['is_active'].sum() +
+                    observation['right_team']['is_active'].sum(), 22)
+    env.restore_state(state)
+    self.assertEqual(play(), expected)
+
+
+if __name__ == '__main__':
+  unittest.main()
@@ -162,6 +162,8 @@ class SMMWrapper(gym.ObservationWrapper):
             low=0, high=255, shape=shape, dtype=np.uint8)
 
     def observation(self, obs):
+        if self.env.unwrapped._config['native_smm']:
+            return self.env.unwrapped.smm(self._channel_dimensions)
         return observation_preprocessing.generate_smm(
             obs, channel_dimensions=self._channel_dimensions,
             config=self.env.unwrapped._config)
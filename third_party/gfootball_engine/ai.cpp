@@ -19,23 +19,100 @@
 #include <sys/prctl.h>
 #include <sys/wait.h>
 
+#include <algorithm>
 #include <cerrno>
 #include <chrono>
+#include <condition_variable>
 #include <ctime>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <mutex>
 #include <ratio>
+#include <sstream>
+#include <thread>
 
 #include "ai/ai_keyboard.hpp"
+#include "ai/smm.hpp"
 #include "file.h"
 #include "gametask.hpp"
+#include "onthepitch/AIsupport/timetoball.hpp"
+#include "onthepitch/player/humanoid/animcollection.hpp"
 
 using namespace boost::python;
 using namespace boost::interprocess;
 
-#define FRAME_SIZE (1280*720*3)
-
 using std::string;
 
+// Fixed set of worker threads executing a parallel loop over environments.
+class EnvWorkerPool {
+ public:
+  explicit EnvWorkerPool(int num_threads) {
+    for (int x = 0; x < num_threads; x++) {
+      workers_.emplace_back([this] { Work(); });
+    }
+  }
+
+  ~EnvWorkerPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      quit_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  // Executes task(index) for each index in [0, count) and waits for all of
+  // them to complete.
+  void Run(int count, const std::function<void(int)>& task) {
+    if (workers_.empty()) {
+      for (int x = 0; x < count; x++) {
+        task(x);
+      }
+      return;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_ = &task;
+    next_ = 0;
+    count_ = count;
+    pending_ = count;
+    work_cv_.notify_all();
+    done_cv_.wait(lock, [this] { return pending_ == 0; });
+    task_ = nullptr;
+  }
+
+ private:
+  void Work() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      work_cv_.wait(lock, [this] { return quit_ || next_ < count_; });
+      if (quit_) {
+        return;
+      }
+      int index = next_++;
+      const std::function<void(int)>* task = task_;
+      lock.unlock();
+      (*task)(index);
+      lock.lock();
+      if (--pending_ == 0) {
+        done_cv_.notify_all();
+      }
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable done_cv_;
+  const std::function<void(int)>* task_ = nullptr;
+  int next_ = 0;
+  int count_ = 0;
+  int pending_ = 0;
+  bool quit_ = false;
+};
+
 void GameEnv::do_step(int count) {
   GetSynchronizationTask()->Step(count);
   while (GetSynchronizationTask()->Steps() > 0) {
@@ -62,13 +139,22 @@ std::string Position::debug() {
          std::to_string(value[2]);
 }
 
-GameEnv::~GameEnv() { }
+GameEnv::~GameEnv() {
+  if (!context) return;
+  SetContext(context);
+  quit_game();
+  delete context;
+  SetContext(nullptr);
+}
 
 void setConfig(ScenarioConfig scenario_config) {
   scenario_config.ball_position.coords[0] =
       scenario_config.ball_position.coords[0] * X_FIELD_SCALE;
   scenario_config.ball_position.coords[1] =
       scenario_config.ball_position.coords[1] * Y_FIELD_SCALE;
+  if (GetGameConfig().physics_only) {
+    scenario_config.render = false;
+  }
   GetScenarioConfig() = scenario_config;
   std::vector<SideSelection> setup = GetMenuTask()->GetControllerSetup();
   CHECK(setup.size() == 2 * MAX_PLAYERS);
@@ -89,7 +175,21 @@ void setConfig(ScenarioConfig scenario_config) {
 }
 
 std::string GameEnv::start_game(GameConfig game_config) {
+  if (game_config.physics_only && game_config.render_mode != e_Disabled) {
+    PyErr_SetString(PyExc_ValueError,
+                    "physics_only mode requires disabled rendering");
+    throw boost::python::error_already_set();
+  }
+  start(game_config, nullptr);
+  return "ok";
+}
+
+void GameEnv::start(GameConfig game_config, GameContext* assets) {
   context = new GameContext();
+  if (assets) {
+    context->anims = assets->anims;
+    context->animPositionCache = assets->animPositionCache;
+  }
   SetContext(context);
   // feenableexcept(FE_INVALID | FE_DIVBYZERO | FE_OVERFLOW);
   GetGameConfig() = game_config;
@@ -109,6 +209,8 @@ std::string GameEnv::start_game(GameConfig game_config) {
   config->Set("game", 0);
   // Enable AI.
   config->SetBool("ai_keyboard", true);
+  config->SetInt("context_x", game_config.render_resolution_x);
+  config->SetInt("context_y", game_config.render_resolution_y);
   if (game_config.render_mode == e_Disabled) {
     config->Set("graphics3d_renderer", "mock");
   } else if (game_config.render_mode == e_Offscreen) {
@@ -119,10 +221,10 @@ std::string GameEnv::start_game(GameConfig game_config) {
   game_ = GetGameTask().get();
   setConfig(ScenarioConfig());
   do_step(1);
-  return "ok";
 }
 
 SharedInfo GameEnv::get_info() {
+  SetContext(context);
   Match* match = game_->GetMatch();
   CHECK(match);
   SharedInfo info;
@@ -134,8 +236,78 @@ SharedInfo GameEnv::get_info() {
 PyObject* GameEnv::get_frame() {
   SetContext(context);
   const screenshoot& screen = GetGraphicsSystem()->GetScreen();
-  PyObject* str = PyBytes_FromStringAndSize(screen.data(), screen.size());
-  return str;
+  return PyMemoryView_FromMemory(const_cast<char*>(screen.data()),
+                                 screen.size(), PyBUF_READ);
+}
+
+PyObject* GameEnv::get_observation_buffer() {
+  raw_observation();
+  return PyMemoryView_FromMemory(reinterpret_cast<char*>(observation_),
+                                 sizeof(RawObservation), PyBUF_READ);
+}
+
+const RawObservation& GameEnv::raw_observation() {
+  if (!observation_) {
+    observation_ = &observation_storage_;
+    update_observation();
+  }
+  return *observation_;
+}
+
+// Acquires writable, C-contiguous buffer of exactly 'size' bytes from the
+// python object. Has to be released with PyBuffer_Release.
+static void get_writable_buffer(PyObject* object, size_t size,
+                                Py_buffer* view) {
+  if (PyObject_GetBuffer(object, view, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS)) {
+    throw boost::python::error_already_set();
+  }
+  if (static_cast<size_t>(view->len) != size) {
+    PyBuffer_Release(view);
+    PyErr_SetString(PyExc_ValueError, "buffer has invalid size");
+    throw boost::python::error_already_set();
+  }
+}
+
+static void check_smm_config(int width, int height, int stack) {
+  if (width < 1 || height < 1 || stack < 1) {
+    PyErr_SetString(PyExc_ValueError, "invalid SMM configuration");
+    throw boost::python::error_already_set();
+  }
+}
+
+int GameEnv::agents() {
+  SetContext(context);
+  return GetScenarioConfig().left_agents + GetScenarioConfig().right_agents;
+}
+
+void GameEnv::render_smm(const SmmRasterizer& rasterizer, uint8_t* buffer) {
+  const RawObservation& observation = raw_observation();
+  SetContext(context);
+  rasterizer.Rasterize(observation, GetScenarioConfig().left_agents,
+                       GetScenarioConfig().right_agents, smm_new_episode_,
+                       buffer);
+  smm_new_episode_ = false;
+}
+
+void GameEnv::get_smm(PyObject* buffer, int width, int height, int stack,
+                      bool sides_swap) {
+  check_smm_config(width, height, stack);
+  SmmRasterizer rasterizer(width, height, stack, sides_swap);
+  Py_buffer view;
+  get_writable_buffer(buffer, rasterizer.BufferSize(agents()), &view);
+  render_smm(rasterizer, static_cast<uint8_t*>(view.buf));
+  PyBuffer_Release(&view);
+}
+
+void GameEnv::update_observation() {
+  if (!observation_) {
+    return;
+  }
+  SetContext(context);
+  Match* match = game_->GetMatch();
+  if (match) {
+    match->GetState(observation_);
+  }
 }
 
 void GameEnv::action(int action, bool left_team, int player) {
@@ -243,9 +415,15 @@ void GameEnv::action(int action, bool left_team, int player) {
 }
 
 void GameEnv::step() {
-  SetContext(context);
   PyThreadState* _save = NULL;
   Py_UNBLOCK_THREADS;
+  step_internal();
+  Py_BLOCK_THREADS;
+}
+
+void GameEnv::step_internal() {
+  SetContext(context);
+  ProfileScope profileScope(e_ProfileSection_Step);
   // We do 10 environment steps per second, while game does 100 frames of
   // physics animation.
   int steps_to_do = GetGameConfig().physics_steps_per_frame;
@@ -273,13 +451,17 @@ void GameEnv::step() {
     set_rendering(GetScenarioConfig().render);
     do_step(1);
   }
-  Py_BLOCK_THREADS;
+  update_observation();
 }
 
 void GameEnv::reset(ScenarioConfig game_config) {
-  SetContext(context);
   PyThreadState* _save = NULL;
   Py_UNBLOCK_THREADS;
+  reset_internal(game_config);
+  Py_BLOCK_THREADS;
+}
+
+void GameEnv::reset_internal(ScenarioConfig game_config) {
   SetContext(context);
   setConfig(game_config);
   for (auto controller : GetControllers()) {
@@ -291,6 +473,351 @@ void GameEnv::reset(ScenarioConfig game_config) {
   context->vertices_manager.RemoveUnused();
   GetMenuTask()->SetMenuAction(e_MenuAction_Menu);
   do_step(1);
+  update_observation();
+  smm_new_episode_ = true;
+}
+
+void GameEnv::ProcessState(EnvState* state) {
+  for (auto controller : GetControllers()) {
+    static_cast<AIControlledKeyboard*>(controller)->ProcessState(state);
+  }
+  context->environment_manager.ProcessState(state);
+  context->scheduler.ProcessState(state);
+  ScenarioConfig& scenario_config = GetScenarioConfig();
+  state->Process(scenario_config.ball_position);
+  state->Process(scenario_config.left_team);
+  state->Process(scenario_config.right_team);
+  state->Verify(scenario_config.left_agents);
+  state->Verify(scenario_config.right_agents);
+  state->Process(scenario_config.use_magnet);
+  state->Process(scenario_config.offsides);
+  state->Process(scenario_config.game_engine_random_seed);
+  state->Process(scenario_config.symmetrical_teams);
+  state->Process(scenario_config.game_difficulty);
+  state->Process(scenario_config.kickoff_for_goal_loosing_team);
+  game_->GetMatch()->ProcessState(state);
+  // Restoring the match can draw random numbers (players being sent off get
+  // reset), so random generators have to go last.
+  // The Mersenne twister only exposes its state words through operator<<.
+  for (auto rng : {&context->rng, &context->rng_non_deterministic}) {
+    uint32_t words[GameContext::BaseGenerator::state_size];
+    if (!state->IsLoading()) {
+      std::stringstream stream;
+      stream << rng->engine();
+      for (auto& word : words) {
+        stream >> word;
+      }
+    }
+    state->Process(words);
+    if (state->IsLoading() && !state->Failed()) {
+      uint32_t* first = words;
+      rng->engine().seed(first, std::end(words));
+    }
+  }
+}
+
+PyObject* GameEnv::save_state() {
+  SetContext(context);
+  Match* match = game_->GetMatch();
+  CHECK(match);
+  EnvState state(match);
+  ProcessState(&state);
+  return PyBytes_FromStringAndSize(state.GetState().data(),
+                                   state.GetState().size());
+}
+
+void GameEnv::restore_state(PyObject* state) {
+  if (!PyBytes_Check(state)) {
+    PyErr_SetString(PyExc_TypeError, "state has to be of bytes type");
+    throw boost::python::error_already_set();
+  }
+  SetContext(context);
+  Match* match = game_->GetMatch();
+  CHECK(match);
+  EnvState env_state(match, std::string(PyBytes_AsString(state),
+                                        PyBytes_Size(state)));
+  ProcessState(&env_state);
+  if (!env_state.Finished()) {
+    PyErr_SetString(PyExc_ValueError,
+                    "state doesn't match the environment, which has to be "
+                    "reset before it can be used again");
+    throw boost::python::error_already_set();
+  }
+  update_observation();
+  smm_new_episode_ = true;
+}
+
+void GameEnv::write_animation_cache(const std::string& filename) {
+  SetContext(context);
+  CHECK(context->anims);
+  if (!context->anims->SaveCache(GetGameConfig().updatePath(filename),
+                                    *context->animPositionCache)) {
+    PyErr_SetString(PyExc_IOError, "failed to write animation cache");
+    throw boost::python::error_already_set();
+  }
+}
+
+void GameEnv::set_profiling(bool enabled) {
+  SetContext(context);
+  if (enabled) {
+    context->profiler.Reset();
+  }
+  context->profiler.SetEnabled(enabled);
+}
+
+bp::dict GameEnv::get_profile() {
+  bp::dict result;
+  for (auto& section : context->profiler.GetSections()) {
+    bp::dict stats;
+    stats["count"] = section.count;
+    stats["total_ms"] = section.total_ms;
+    stats["max_ms"] = section.max_ms;
+    bp::list histogram;
+    for (auto count : section.histogram) {
+      histogram.append(count);
+    }
+    stats["histogram"] = histogram;
+    result[section.name] = stats;
+  }
+  return result;
+}
+
+bp::dict GameEnv::benchmark_anim_selection(int steps, int repeats) {
+#ifndef BENCHMARK_HOOKS
+  PyErr_SetString(PyExc_RuntimeError,
+                  "the engine has to be built with BENCHMARK_HOOKS");
+  throw boost::python::error_already_set();
+#else
+  std::vector<CrudeSelectionQuery> queries;
+  PyThreadState* _save = NULL;
+  Py_UNBLOCK_THREADS;
+  SetContext(context);
+  context->animQueryLog = &queries;
+  for (int x = 0; x < steps; x++) {
+    step_internal();
+  }
+  context->animQueryLog = nullptr;
+  AnimCollection& anims = *context->anims;
+  int mismatches = 0;
+  for (auto& query : queries) {
+    DataSet linear, indexed;
+    anims.CrudeSelectionLinear(linear, query);
+    anims.CrudeSelection(indexed, query);
+    if (linear != indexed) {
+      mismatches++;
+    }
+  }
+  double times_ms[2];
+  DataSet selection;
+  for (int indexed = 0; indexed < 2; indexed++) {
+    auto start = std::chrono::steady_clock::now();
+    for (int x = 0; x < repeats; x++) {
+      for (auto& query : queries) {
+        selection.clear();
+        if (indexed) {
+          anims.CrudeSelection(selection, query);
+        } else {
+          anims.CrudeSelectionLinear(selection, query);
+        }
+      }
+    }
+    times_ms[indexed] = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+  }
+  Py_BLOCK_THREADS;
+  bp::dict result;
+  result["queries"] = queries.size();
+  result["mismatches"] = mismatches;
+  result["linear_ms"] = times_ms[0];
+  result["indexed_ms"] = times_ms[1];
+  return result;
+#endif
+}
+
+bp::dict GameEnv::benchmark_time_to_ball(int steps, int repeats) {
+#ifndef BENCHMARK_HOOKS
+  PyErr_SetString(PyExc_RuntimeError,
+                  "the engine has to be built with BENCHMARK_HOOKS");
+  throw boost::python::error_already_set();
+#else
+  std::vector<TimeToBallQuery> queries;
+  PyThreadState* _save = NULL;
+  Py_UNBLOCK_THREADS;
+  SetContext(context);
+  context->timeToBallLog = &queries;
+  for (int x = 0; x < steps; x++) {
+    step_internal();
+  }
+  context->timeToBallLog = nullptr;
+  int players = 0;
+  int mismatches = 0;
+  for (auto& query : queries) {
+    TimeToBallBatch reference = query.batch;
+    reference.CalculateReference(&query.ballPredictions[0]);
+    query.batch.Calculate(&query.ballPredictions[0]);
+    for (int x = 0; x < query.batch.GetSize(); x++) {
+      players++;
+      const TimeNeeded& a = reference.GetResult(x);
+      const TimeNeeded& b = query.batch.GetResult(x);
+      if (a.usual_ms != b.usual_ms || a.optimistic_ms != b.optimistic_ms) {
+        mismatches++;
+      }
+    }
+  }
+  double times_ms[2];
+  for (int batched = 0; batched < 2; batched++) {
+    auto start = std::chrono::steady_clock::now();
+    for (int x = 0; x < repeats; x++) {
+      for (auto& query : queries) {
+        if (batched) {
+          query.batch.Calculate(&query.ballPredictions[0]);
+        } else {
+          query.batch.CalculateReference(&query.ballPredictions[0]);
+        }
+      }
+    }
+    times_ms[batched] = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+  }
+  Py_BLOCK_THREADS;
+  bp::dict result;
+  result["queries"] = queries.size();
+  result["players"] = players;
+  result["mismatches"] = mismatches;
+  result["reference_ms"] = times_ms[0];
+  result["batched_ms"] = times_ms[1];
+  return result;
+#endif
+}
+
+GameEnvBatch::~GameEnvBatch() {
+  pool_.reset();
+  for (auto env : envs_) {
+    delete env;
+  }
+}
+
+std::string GameEnvBatch::start_game(GameConfig game_config, int num_envs,
+                                     int num_threads) {
+  if (game_config.render_mode != e_Disabled) {
+    PyErr_SetString(PyExc_ValueError,
+                    "GameEnvBatch supports only disabled rendering");
+    throw boost::python::error_already_set();
+  }
+  if (num_envs < 1 || !envs_.empty()) {
+    PyErr_SetString(PyExc_ValueError, "invalid number of environments");
+    throw boost::python::error_already_set();
+  }
+  PyThreadState* _save = NULL;
+  Py_UNBLOCK_THREADS;
+  // The first environment loads the animations, all the others reuse them.
+  for (int x = 0; x < num_envs; x++) {
+    GameEnv* env = new GameEnv();
+    env->start(game_config, envs_.empty() ? nullptr : envs_[0]->context);
+    envs_.push_back(env);
+  }
+  observations_.resize(num_envs);
+  for (int x = 0; x < num_envs; x++) {
+    envs_[x]->observation_ = &observations_[x];
+    envs_[x]->update_observation();
+  }
+  pool_.reset(new EnvWorkerPool(std::min(num_threads, num_envs)));
+  Py_BLOCK_THREADS;
+  return "ok";
+}
+
+GameEnv* GameEnvBatch::env(int index) {
+  if (index < 0 || index >= static_cast<int>(envs_.size())) {
+    PyErr_SetString(PyExc_IndexError, "environment index out of range");
+    throw boost::python::error_already_set();
+  }
+  return envs_[index];
+}
+
+EnvWorkerPool* GameEnvBatch::pool() {
+  if (!pool_) {
+    PyErr_SetString(PyExc_RuntimeError, "GameEnvBatch is not started");
+    throw boost::python::error_already_set();
+  }
+  return pool_.get();
+}
+
+SharedInfo GameEnvBatch::get_info(int index) {
+  return env(index)->get_info();
+}
+
+PyObject* GameEnvBatch::get_observation_buffer() {
+  return PyMemoryView_FromMemory(
+      reinterpret_cast<char*>(observations_.data()),
+      observations_.size() * sizeof(RawObservation), PyBUF_READ);
+}
+
+void GameEnvBatch::get_smm(PyObject* buffer, int width, int height,
+                           int stack, bool sides_swap) {
+  check_smm_config(width, height, stack);
+  EnvWorkerPool* workers = pool();
+  int agents = envs_.empty() ? 0 : envs_[0]->agents();
+  for (auto env : envs_) {
+    if (env->agents() != agents) {
+      PyErr_SetString(PyExc_ValueError,
+                      "all environments need the same number of agents");
+      throw boost::python::error_already_set();
+    }
+  }
+  SmmRasterizer rasterizer(width, height, stack, sides_swap);
+  const size_t env_size = rasterizer.BufferSize(agents);
+  Py_buffer view;
+  get_writable_buffer(buffer, env_size * envs_.size(), &view);
+  uint8_t* data = static_cast<uint8_t*>(view.buf);
+  PyThreadState* _save = NULL;
+  Py_UNBLOCK_THREADS;
+  workers->Run(envs_.size(), [&](int index) {
+    envs_[index]->render_smm(rasterizer, data + index * env_size);
+  });
+  Py_BLOCK_THREADS;
+  PyBuffer_Release(&view);
+}
+
+void GameEnvBatch::action(int index, int action, bool left_team, int player) {
+  env(index)->action(action, left_team, player);
+}
+
+void GameEnvBatch::reset(int index, ScenarioConfig game_config) {
+  env(index)->reset(game_config);
+}
+
+void GameEnvBatch::reset_all(bp::list game_configs) {
+  EnvWorkerPool* workers = pool();
+  if (len(game_configs) != static_cast<int>(envs_.size())) {
+    PyErr_SetString(PyExc_ValueError,
+                    "expected one scenario config per environment");
+    throw boost::python::error_already_set();
+  }
+  std::vector<ScenarioConfig> configs;
+  for (size_t x = 0; x < envs_.size(); x++) {
+    configs.push_back(extract<ScenarioConfig>(game_configs[x]));
+  }
+  PyThreadState* _save = NULL;
+  Py_UNBLOCK_THREADS;
+  workers->Run(envs_.size(), [&](int index) {
+    envs_[index]->reset_internal(configs[index]);
+  });
+  Py_BLOCK_THREADS;
+}
+
+PyObject* GameEnvBatch::save_state(int index) {
+  return env(index)->save_state();
+}
+
+void GameEnvBatch::restore_state(int index, PyObject* state) {
+  env(index)->restore_state(state);
+}
+
+void GameEnvBatch::step() {
+  EnvWorkerPool* workers = pool();
+  PyThreadState* _save = NULL;
+  Py_UNBLOCK_THREADS;
+  workers->Run(envs_.size(), [this](int index) { envs_[index]->step_internal(); });
   Py_BLOCK_THREADS;
 }
 
@@ -345,11 +872,33 @@ BOOST_PYTHON_MODULE(_gameplayfootball) {
       .def("start_game", &GameEnv::start_game)
       .def("get_info", &GameEnv::get_info)
       .def("get_frame", &GameEnv::get_frame)
+      .def("get_observation_buffer", &GameEnv::get_observation_buffer)
+      .def("get_smm", &GameEnv::get_smm)
       .def("perform_action", &GameEnv::action)
       .def("step", &GameEnv::step)
-      .def("reset", &GameEnv::reset);
+      .def("reset", &GameEnv::reset)
+      .def("save_state", &GameEnv::save_state)
+      .def("restore_state", &GameEnv::restore_state)
+      .def("benchmark_anim_selection", &GameEnv::benchmark_anim_selection)
+      .def("benchmark_time_to_ball", &GameEnv::benchmark_time_to_ball)
+      .def("set_profiling", &GameEnv::set_profiling)
+      .def("get_profile", &GameEnv::get_profile)
+      .def("write_animation_cache", &GameEnv::write_animation_cache);
   ;
 
+  class_<GameEnvBatch, boost::noncopyable>("GameEnvBatch")
+      .def("start_game", &GameEnvBatch::start_game)
+      .def("size", &GameEnvBatch::size)
+      .def("get_info", &GameEnvBatch::get_info)
+      .def("get_observation_buffer", &GameEnvBatch::get_observation_buffer)
+      .def("get_smm", &GameEnvBatch::get_smm)
+      .def("perform_action", &GameEnvBatch::action)
+      .def("step", &GameEnvBatch::step)
+      .def("reset", &GameEnvBatch::reset)
+      .def("reset_all", &GameEnvBatch::reset_all)
+      .def("save_state", &GameEnvBatch::save_state)
+      .def("restore_state", &GameEnvBatch::restore_state);
+
   class_<Vector3>("Vector3", init<float, float, float>())
      .def("__getitem__", &Vector3::GetEnvCoord)
      .def("__setitem__", &Vector3::SetEnvCoord)
@@ -359,7 +908,12 @@ BOOST_PYTHON_MODULE(_gameplayfootball) {
       .def_readwrite("high_quality", &GameConfig::high_quality)
       .def_readwrite("render_mode", &GameConfig::render_mode)
       .def_readwrite("physics_steps_per_frame",
-                     &GameConfig::physics_steps_per_frame);
+                     &GameConfig::physics_steps_per_frame)
+      .def_readwrite("render_resolution_x", &GameConfig::render_resolution_x)
+      .def_readwrite("render_resolution_y", &GameConfig::render_resolution_y)
+      .def_readwrite("use_animation_cache",
+                     &GameConfig::use_animation_cache)
+      .def_readwrite("physics_only", &GameConfig::physics_only);
 
   class_<ScenarioConfig>("ScenarioConfig")
       .def_readwrite("ball_position", &ScenarioConfig::ball_position)
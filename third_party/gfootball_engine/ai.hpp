@@ -30,6 +30,8 @@ namespace bp = boost::python;
 
 class AIControlledKeyboard;
 class GameTask;
+class SmmRasterizer;
+class EnvWorkerPool;
 
 typedef std::vector<std::string> StringVector;
 
@@ -42,23 +44,140 @@ struct GameEnv {
   // Get the current state of the game (observation).
   SharedInfo get_info();
 
-  // Get the current rendered frame.
+  // Get the last rendered frame: read-only buffer of
+  // [render_resolution_y, render_resolution_x, 3] RGB pixels, top row first.
+  // Frames are read back asynchronously, so this is the frame rendered one
+  // step before the current one. The buffer is only valid until the next call
+  // to step.
   PyObject* get_frame();
 
+  // Returns a read-only buffer with the RawObservation of the game, which is
+  // updated in place after each step, reset and restore_state. The buffer is
+  // valid for the lifetime of the environment.
+  PyObject* get_observation_buffer();
+
+  // Rasterizes Super Mini Map of all the agents (left ones first) into
+  // 'buffer', a writable C-contiguous uint8 array of shape
+  // [agents, height, width, layers * stack]. Stacked frames are shifted on
+  // each call, so it should be called once per step.
+  void get_smm(PyObject* buffer, int width, int height, int stack,
+               bool sides_swap);
+
   // Executes the action inside the game.
   void action(int action, bool left_team, int player);
   void reset(ScenarioConfig game_config);
   void step();
 
+  // Returns a binary snapshot of the complete match state.
+  PyObject* save_state();
+  // Restores a snapshot returned by save_state(). The environment needs to
+  // be reset to a scenario with the same teams and number of agents first.
+  void restore_state(PyObject* state);
+
+  // Records animation selection queries issued during 'steps' environment
+  // steps, then replays them 'repeats' times through both the indexed and the
+  // linear (reference) selection. Returns timings and the number of queries
+  // for which the two selected different animations. Needs the engine to be
+  // built with BENCHMARK_HOOKS.
+  bp::dict benchmark_anim_selection(int steps, int repeats);
+
+  // Records time to ball calculations of the teams during 'steps'
+  // environment steps, then repeats them 'repeats' times with both the
+  // batched and the per-player (reference) implementation. Returns timings
+  // and the number of players for which the two gave different times. Needs
+  // the engine to be built with BENCHMARK_HOOKS.
+  bp::dict benchmark_time_to_ball(int steps, int repeats);
+
+  // Writes the prepared animations of the game to the binary animation cache
+  // 'filename' (relative to the data directory), which is then used instead
+  // of the animation sources by newly started games.
+  void write_animation_cache(const std::string& filename);
+
+  // Enables or disables collection of engine timings. Enabling the profiler
+  // clears previously collected timings.
+  void set_profiling(bool enabled);
+  // Returns the timings collected while profiling was enabled, as a dict of
+  // section name -> {'count', 'total_ms', 'max_ms', 'histogram'}, where
+  // histogram holds the number of durations under 1 us, in [1, 2) us,
+  // [2, 4) us and so on (see Profiler::Section).
+  bp::dict get_profile();
+  // Same timings, for use from C++.
+  const Profiler& profiler() const { return context->profiler; }
+
   private:
+  friend struct GameEnvBatch;
+  // Starts the game, reusing animations already loaded by 'assets' (if set).
+  void start(GameConfig game_config, GameContext* assets);
+  // Versions of 'reset' and 'step' which don't touch the Python interpreter
+  // state, so they can run on any thread.
+  void reset_internal(ScenarioConfig game_config);
+  void step_internal();
   void do_step(int count = 1);
   void getObservations();
-  GameContext* context;
+  void ProcessState(EnvState* state);
+  void update_observation();
+  const RawObservation& raw_observation();
+  int agents();
+  void render_smm(const SmmRasterizer& rasterizer, uint8_t* buffer);
+  GameContext* context = nullptr;
 
   AIControlledKeyboard* keyboard_;
   GameTask* game_;
   bool disable_graphics_ = false;
   int last_step_rendered_frames_ = 1;
+  // Where the observation is written to, null if nobody asked for it.
+  RawObservation* observation_ = nullptr;
+  RawObservation observation_storage_;
+  // Whether next SMM should fill the whole frame stack.
+  bool smm_new_episode_ = true;
+};
+
+// Set of independent game environments living in a single process. All
+// environments share read-only animation data and are stepped together on a
+// pool of worker threads, with the Python GIL released.
+struct GameEnvBatch {
+  ~GameEnvBatch();
+  // Start 'num_envs' games using 'num_threads' worker threads. Rendering
+  // must be disabled.
+  std::string start_game(GameConfig game_config, int num_envs,
+                         int num_threads);
+
+  int size() const { return envs_.size(); }
+
+  // Get the current state of the given environment.
+  SharedInfo get_info(int env);
+
+  // Returns a read-only buffer holding RawObservations of all the
+  // environments, one after another ([size() x fields] array of floats).
+  // Observations are updated in place by the worker threads while stepping.
+  PyObject* get_observation_buffer();
+
+  // Same as GameEnv::get_smm, for all the environments at once ('buffer'
+  // has an extra leading dimension of size()). All the environments need to
+  // have the same number of agents.
+  void get_smm(PyObject* buffer, int width, int height, int stack,
+               bool sides_swap);
+
+  // Executes the action inside the given environment.
+  void action(int env, int action, bool left_team, int player);
+  void reset(int env, ScenarioConfig game_config);
+  // Resets all the environments in parallel, 'game_configs' holds one
+  // ScenarioConfig per environment.
+  void reset_all(bp::list game_configs);
+  PyObject* save_state(int env);
+  void restore_state(int env, PyObject* state);
+
+  // Steps all the environments in parallel.
+  void step();
+
+  private:
+  GameEnv* env(int index);
+  // Raises a Python error if the batch has not been (successfully) started.
+  EnvWorkerPool* pool();
+
+  std::vector<GameEnv*> envs_;
+  std::vector<RawObservation> observations_;
+  boost::shared_ptr<EnvWorkerPool> pool_;
 };
 
 #endif
@@ -0,0 +1,156 @@
+// Copyright 2019 Google LLC & Bastiaan Konings
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Headless engine throughput benchmark. Plays full 11 vs 11 matches with
+// fixed seeds, the single agent performing pseudo-random (but fixed) actions,
+// and reports steps per second, the cost of engine sections and peak memory
+// use, so that engine versions can be compared.
+//
+// Usage: engine_benchmark [--matches=N] [--steps=N] [--seed=N]
+//                         [--physics_only] [--data_dir=DIR]
+
+#include "ai.hpp"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+// The benchmark's own full match setup. It is defined here rather than loaded
+// from gfootball/scenarios, so that it stays fixed and results remain
+// comparable when the Python scenarios change.
+static ScenarioConfig CreateBenchmarkScenario(unsigned int seed) {
+  const FormationEntry team[] = {
+      FormationEntry(-1.000000, 0.000000, e_PlayerRole_GK, false),
+      FormationEntry(0.000000, 0.020000, e_PlayerRole_RM, false),
+      FormationEntry(0.000000, -0.020000, e_PlayerRole_CF, false),
+      FormationEntry(-0.422000, -0.19576, e_PlayerRole_LB, false),
+      FormationEntry(-0.500000, -0.06356, e_PlayerRole_CB, false),
+      FormationEntry(-0.500000, 0.063559, e_PlayerRole_CB, false),
+      FormationEntry(-0.422000, 0.195760, e_PlayerRole_RB, false),
+      FormationEntry(-0.184212, -0.10568, e_PlayerRole_CM, false),
+      FormationEntry(-0.267574, 0.000000, e_PlayerRole_CM, false),
+      FormationEntry(-0.184212, 0.105680, e_PlayerRole_CM, false),
+      FormationEntry(-0.010000, -0.21610, e_PlayerRole_LM, false)};
+  ScenarioConfig scenario;
+  scenario.left_team.assign(std::begin(team), std::end(team));
+  scenario.right_team.assign(std::begin(team), std::end(team));
+  scenario.right_team[1] =
+      FormationEntry(-0.050000, 0.000000, e_PlayerRole_RM, false);
+  scenario.right_team[2] =
+      FormationEntry(-0.010000, 0.216102, e_PlayerRole_CF, false);
+  scenario.left_agents = 1;
+  scenario.right_agents = 0;
+  scenario.render = false;
+  scenario.game_difficulty = 0.6;
+  scenario.game_engine_random_seed = seed;
+  return scenario;
+}
+
+static bool ParseFlag(const std::string& arg, const std::string& name,
+                      std::string* value) {
+  std::string prefix = "--" + name + "=";
+  if (arg.compare(0, prefix.size(), prefix) != 0) return false;
+  *value = arg.substr(prefix.size());
+  return true;
+}
+
+int main(int argc, char** argv) {
+  int matches = 2;
+  int steps = 3000;
+  unsigned int seed = 42;
+  GameConfig game_config;
+  game_config.render_mode = e_Disabled;
+  for (int x = 1; x < argc; x++) {
+    std::string arg = argv[x];
+    std::string value;
+    if (ParseFlag(arg, "matches", &value)) {
+      matches = std::stoi(value);
+    } else if (ParseFlag(arg, "steps", &value)) {
+      steps = std::stoi(value);
+    } else if (ParseFlag(arg, "seed", &value)) {
+      seed = std::stoul(value);
+    } else if (ParseFlag(arg, "data_dir", &value)) {
+      setenv("GFOOTBALL_DATA_DIR", value.c_str(), 1);
+    } else if (arg == "--physics_only") {
+      game_config.physics_only = true;
+    } else {
+      fprintf(stderr, "Unknown argument: %s\n", arg.c_str());
+      return 1;
+    }
+  }
+  if (!getenv("GFOOTBALL_DATA_DIR")) {
+    setenv("GFOOTBALL_DATA_DIR", GFOOTBALL_ENGINE_DIR "/data", 0);
+  }
+  if (!getenv("GFOOTBALL_FONT")) {
+    setenv("GFOOTBALL_FONT",
+           GFOOTBALL_ENGINE_DIR "/../fonts/AlegreyaSansSC-ExtraBold.ttf", 0);
+  }
+
+  // GameEnv releases and reacquires the interpreter lock while stepping.
+  Py_Initialize();
+  auto start = std::chrono::steady_clock::now();
+  GameEnv env;
+  env.start_game(game_config);
+  double startup_s = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> actions(game_idle, game_release_dribble);
+  double play_s = 0.0;
+  // Only the steps are profiled, sections of all the matches are summed up.
+  std::vector<Profiler::Section> sections;
+  for (int match = 0; match < matches; match++) {
+    env.reset(CreateBenchmarkScenario(seed + match));
+    env.set_profiling(true);
+    start = std::chrono::steady_clock::now();
+    for (int step = 0; step < steps; step++) {
+      env.action(actions(rng), true, 0);
+      env.step();
+    }
+    play_s += std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    env.set_profiling(false);
+    auto& match_sections = env.profiler().GetSections();
+    sections.resize(match_sections.size());
+    for (size_t x = 0; x < sections.size(); x++) {
+      sections[x].name = match_sections[x].name;
+      sections[x].count += match_sections[x].count;
+      sections[x].total_ms += match_sections[x].total_ms;
+      sections[x].max_ms =
+          std::max(sections[x].max_ms, match_sections[x].max_ms);
+    }
+  }
+
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  int total_steps = matches * steps;
+  printf("Startup: %.2f s\n", startup_s);
+  printf("Steps: %d in %.2f s, %.1f steps/s\n", total_steps, play_s,
+         total_steps / play_s);
+  printf("Peak RSS: %.1f MB\n", usage.ru_maxrss / 1024.0);
+  printf("%-50s %10s %12s %12s %10s\n", "Section", "Count", "Total ms",
+         "us / step", "Max ms");
+  for (auto& section : sections) {
+    if (section.count == 0) continue;
+    printf("%-50s %10lu %12.1f %12.1f %10.3f\n", section.name.c_str(),
+           section.count, section.total_ms,
+           section.total_ms * 1000.0 / total_steps, section.max_ms);
+  }
+  return 0;
+}
@@ -15,6 +15,8 @@ set(BASE_HEADERS
    src/base/log.hpp
    src/base/utils.hpp
    src/base/properties.hpp
+   src/base/profiler.hpp
+   src/base/binarystream.hpp
    src/base/sdl_surface.hpp
 )
 
@@ -38,6 +40,8 @@ set(BASE_SOURCES
    src/base/sdl_surface.cpp
    src/base/utils.cpp
    src/base/properties.cpp
+   src/base/profiler.cpp
+   src/base/binarystream.cpp
    src/base/log.cpp
    src/base/geometry/triangle.cpp
    src/base/geometry/line.cpp
@@ -227,6 +231,7 @@ set(MANAGERS_SOURCES
 
 set(UTILS_HEADERS
    src/utils/animation.hpp
+   src/utils/animationcache.hpp
    src/utils/objectloader.hpp
    src/utils/xmlloader.hpp
    src/utils/splitgeometry.hpp
@@ -241,6 +246,7 @@ set(UTILS_EXT_HEADERS
 set(UTILS_SOURCES
    src/utils/orbitcamera.cpp
    src/utils/animation.cpp
+   src/utils/animationcache.cpp
    src/utils/splitgeometry.cpp
    src/utils/objectloader.cpp
    src/utils/xmlloader.cpp
@@ -293,11 +299,13 @@ set(BLUNTED_CORE_SOURCES
 set(AI_HEADERS
   ai.cpp
   src/ai/ai_keyboard.hpp
+  src/ai/smm.hpp
 )
 
 set(AI_SOURCES
   ai.hpp
   src/ai/ai_keyboard.cpp
+  src/ai/smm.cpp
 )
 
 set(CLIENT_SOURCES
@@ -353,6 +361,7 @@ set(GAME_HEADERS
    src/onthepitch/match.hpp
    src/onthepitch/AIsupport/AIfunctions.hpp
    src/onthepitch/AIsupport/mentalimage.hpp
+   src/onthepitch/AIsupport/timetoball.hpp
    src/onthepitch/teamAIcontroller.hpp
    src/onthepitch/proceduralpitch.hpp
 )
@@ -382,6 +391,7 @@ set(GAME_SOURCES
    src/onthepitch/referee.cpp
    src/onthepitch/AIsupport/mentalimage.cpp
    src/onthepitch/AIsupport/AIfunctions.cpp
+   src/onthepitch/AIsupport/timetoball.cpp
    src/onthepitch/proceduralpitch.cpp
    src/onthepitch/team.cpp
    src/onthepitch/teamAIcontroller.cpp
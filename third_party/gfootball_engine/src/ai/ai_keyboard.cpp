@@ -13,6 +13,8 @@
 
 #include "ai_keyboard.hpp"
 
+#include "../gamedefines.hpp"
+
 
 AIControlledKeyboard::AIControlledKeyboard() {
   deviceType = e_HIDeviceType_Keyboard;
@@ -52,3 +54,7 @@ void AIControlledKeyboard::Reset() {
   buttons_pressed_.clear();
 }
 
+void AIControlledKeyboard::ProcessState(EnvState* state) {
+  state->Process(direction_);
+  state->Process(buttons_pressed_);
+}
@@ -18,6 +18,8 @@
 #include "../hid/ihidevice.hpp"
 #include <set>
 
+class EnvState;
+
 
 class AIControlledKeyboard : public IHIDevice {
 
@@ -38,6 +40,7 @@ class AIControlledKeyboard : public IHIDevice {
     // Methods for remote controlling.
     void SetDirection(const Vector3& new_direction);
     virtual void Reset();
+    void ProcessState(EnvState* state);
 
   private:
     Vector3 direction_;
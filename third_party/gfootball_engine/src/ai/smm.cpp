@@ -0,0 +1,109 @@
+// Copyright 2019 Google LLC & Bastiaan Konings
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "smm.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+// Normalized minimap coordinates (in environment coordinates).
+constexpr double minimapXMin = -1.0;
+constexpr double minimapXMax = 1.0;
+constexpr double minimapYMin = -1.0 / 2.25;
+constexpr double minimapYMax = 1.0 / 2.25;
+
+enum e_SmmLayer {
+  e_SmmLayer_LeftTeam,
+  e_SmmLayer_RightTeam,
+  e_SmmLayer_Ball,
+  e_SmmLayer_Active,
+  e_SmmLayer_IsLeft,
+};
+
+SmmRasterizer::SmmRasterizer(int width, int height, int stack,
+                             bool sides_swap)
+    : width_(width), height_(height), stack_(stack), sides_swap_(sides_swap) {
+}
+
+size_t SmmRasterizer::BufferSize(int agents) const {
+  return static_cast<size_t>(agents) * width_ * height_ * Channels();
+}
+
+void SmmRasterizer::MarkPoint(uint8_t *frame, int channel, float x,
+                              float y) const {
+  int px = static_cast<int>((x - minimapXMin) / (minimapXMax - minimapXMin) *
+                            width_);
+  int py = static_cast<int>((y - minimapYMin) / (minimapYMax - minimapYMin) *
+                            height_);
+  px = std::max(0, std::min(width_ - 1, px));
+  py = std::max(0, std::min(height_ - 1, py));
+  frame[(py * width_ + px) * Channels() + channel] = 255;
+}
+
+void SmmRasterizer::Rasterize(const RawObservation &observation,
+                              int left_agents, int right_agents,
+                              bool new_episode, uint8_t *buffer) const {
+  const int layers = Layers();
+  const int channels = Channels();
+  const int pixels = width_ * height_;
+  const size_t size = BufferSize(left_agents + right_agents);
+  const int newest = (stack_ - 1) * layers;
+  if (new_episode || stack_ == 1) {
+    memset(buffer, 0, size);
+  } else {
+    // Shifting the whole buffer moves each pixel's older frames one slot
+    // down. The newest slot gets garbage from the next pixel, so clear it.
+    memmove(buffer, buffer + layers, size - layers);
+    for (size_t pixel = 0; pixel < size / channels; pixel++) {
+      memset(buffer + pixel * channels + newest, 0, layers);
+    }
+  }
+
+  const int team_size[2] = {static_cast<int>(observation.left_team_size),
+                            static_cast<int>(observation.right_team_size)};
+  const RawPlayerInfo *teams[2] = {observation.left_team,
+                                   observation.right_team};
+  for (int agent = 0; agent < left_agents + right_agents; agent++) {
+    uint8_t *frame = buffer + static_cast<size_t>(agent) * pixels * channels;
+    bool is_left = agent < left_agents;
+    for (int team = 0; team < 2; team++) {
+      for (int x = 0; x < team_size[team]; x++) {
+        MarkPoint(frame, newest + e_SmmLayer_LeftTeam + team,
+                  teams[team][x].position[0], teams[team][x].position[1]);
+      }
+    }
+    MarkPoint(frame, newest + e_SmmLayer_Ball, observation.ball_position[0],
+              observation.ball_position[1]);
+    int active = static_cast<int>(
+        is_left ? observation.left_controlled_player[agent]
+                : observation.right_controlled_player[agent - left_agents]);
+    if (active != -1) {
+      const RawPlayerInfo &player = teams[is_left ? 0 : 1][active];
+      MarkPoint(frame, newest + e_SmmLayer_Active, player.position[0],
+                player.position[1]);
+    }
+    if (sides_swap_ && is_left) {
+      for (int pixel = 0; pixel < pixels; pixel++) {
+        frame[pixel * channels + newest + e_SmmLayer_IsLeft] = 1;
+      }
+    }
+    if (new_episode) {
+      for (int pixel = 0; pixel < pixels; pixel++) {
+        uint8_t *data = frame + pixel * channels;
+        for (int slot = 0; slot < stack_ - 1; slot++) {
+          memcpy(data + slot * layers, data + newest, layers);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,51 @@
+// Copyright 2019 Google LLC & Bastiaan Konings
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _AI_SMM
+#define _AI_SMM
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../defines.hpp"
+
+// Rasterizes Super Mini Map (SMM) layers: left team, right team, ball,
+// active player and optionally is_left. Produces the same output as
+// python's observation_preprocessing.generate_smm.
+class SmmRasterizer {
+
+  public:
+    SmmRasterizer(int width, int height, int stack, bool sides_swap);
+
+    int Layers() const { return sides_swap_ ? 5 : 4; }
+    int Channels() const { return Layers() * stack_; }
+    // Size in bytes of the [agents, height, width, Channels()] buffer.
+    size_t BufferSize(int agents) const;
+
+    // Draws the observation for the left agents followed by the right agents
+    // into 'buffer'. Channels of the previous frames are shifted towards the
+    // beginning, so the newest frame is always the last one. With
+    // 'new_episode' set the frame is replicated over the whole stack.
+    void Rasterize(const RawObservation &observation, int left_agents,
+                   int right_agents, bool new_episode, uint8_t *buffer) const;
+
+  private:
+    void MarkPoint(uint8_t *frame, int channel, float x, float y) const;
+
+    int width_;
+    int height_;
+    int stack_;
+    bool sides_swap_;
+};
+
+#endif
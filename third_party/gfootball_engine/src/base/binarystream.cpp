@@ -0,0 +1,42 @@
+// Copyright 2019 Google LLC & Bastiaan Konings
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "binarystream.hpp"
+
+#include <cstring>
+
+namespace blunted {
+
+  void BinaryStreamData::ProcessRaw(void *value, size_t length) {
+    if (failed) return;
+    if (load) {
+      if (length > size - pos) {
+        failed = true;
+        return;
+      }
+      memcpy(value, data + pos, length);
+      pos += length;
+    } else {
+      buffer.append(static_cast<const char*>(value), length);
+    }
+  }
+
+  bool BinaryStreamData::ProcessSize(int &count) {
+    ProcessRaw(&count, sizeof(count));
+    if (load && (failed || count < 0 || (size_t)count > size - pos)) {
+      failed = true;
+    }
+    return !failed;
+  }
+
+}
@@ -0,0 +1,147 @@
+// Copyright 2019 Google LLC & Bastiaan Konings
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _HPP_BINARYSTREAM
+#define _HPP_BINARYSTREAM
+
+#include <deque>
+#include <list>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "math/quaternion.hpp"
+#include "math/vector3.hpp"
+
+namespace blunted {
+
+  // Data of a BinaryStream, see below.
+  class BinaryStreamData {
+
+    public:
+      bool IsLoading() const { return load; }
+      bool Failed() const { return failed; }
+      void SetFailed() { failed = true; }
+      // Whether all the data has been read without errors.
+      bool Finished() const { return !failed && pos == size; }
+      // Written data.
+      const std::string &GetData() const { return buffer; }
+
+      // Processes size of a collection. When loading, returns false if the
+      // size is not plausible for the remaining data.
+      bool ProcessSize(int &count);
+
+    protected:
+      // Starts writing.
+      BinaryStreamData() {}
+      // Starts reading a copy of 'input'.
+      BinaryStreamData(const std::string &input)
+          : load(true), buffer(input), data(buffer.data()), size(buffer.size()) {}
+      // Starts reading 'data', which has to stay valid while reading.
+      BinaryStreamData(const char *data, size_t size)
+          : load(true), data(data), size(size) {}
+      BinaryStreamData(const BinaryStreamData&) = delete;
+      BinaryStreamData &operator=(const BinaryStreamData&) = delete;
+
+      void ProcessRaw(void *value, size_t length);
+
+      bool load = false;
+      bool failed = false;
+
+    private:
+      std::string buffer;
+      const char *data = nullptr;
+      size_t size = 0;
+      size_t pos = 0;
+
+  };
+
+  // Binary stream which either writes values or reads them back, so that
+  // saving and loading share the same Process() calls. 'Derived' adds
+  // Process() overloads of its own types, which are used for the elements
+  // of arrays and collections too (derived classes need to bring these
+  // overloads in with a using declaration).
+  template <typename Derived> class BinaryStream : public BinaryStreamData {
+
+    public:
+      template <typename T> void Process(T &value) {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                      "unsupported type");
+        ProcessRaw(&value, sizeof(T));
+      }
+      template <typename T, size_t N> void Process(T (&values)[N]) {
+        for (size_t x = 0; x < N; x++) {
+          Self().Process(values[x]);
+        }
+      }
+      template <typename T> void Process(std::vector<T> &collection) {
+        ProcessSequence(collection);
+      }
+      template <typename T> void Process(std::list<T> &collection) {
+        ProcessSequence(collection);
+      }
+      template <typename T> void Process(std::deque<T> &collection) {
+        ProcessSequence(collection);
+      }
+      template <typename T> void Process(std::set<T> &collection) {
+        int count = collection.size();
+        Self().Process(count);
+        if (load) {
+          collection.clear();
+          for (int x = 0; x < count && !failed; x++) {
+            T value;
+            Self().Process(value);
+            collection.insert(value);
+          }
+        } else {
+          for (T value : collection) {
+            Self().Process(value);
+          }
+        }
+      }
+      void Process(std::string &value) {
+        int length = value.size();
+        if (!ProcessSize(length)) return;
+        value.resize(length);
+        if (length > 0) ProcessRaw(&value[0], length);
+      }
+      void Process(Vector3 &value) {
+        Process(value.coords);
+      }
+      void Process(Quaternion &value) {
+        Process(value.elements);
+      }
+
+    protected:
+      BinaryStream() {}
+      BinaryStream(const std::string &input) : BinaryStreamData(input) {}
+      BinaryStream(const char *data, size_t size)
+          : BinaryStreamData(data, size) {}
+
+    private:
+      Derived &Self() { return static_cast<Derived&>(*this); }
+      template <typename C> void ProcessSequence(C &collection) {
+        int count = collection.size();
+        if (!ProcessSize(count)) return;
+        collection.resize(count);
+        for (auto &value : collection) {
+          Self().Process(value);
+        }
+      }
+
+  };
+
+}
+
+#endif
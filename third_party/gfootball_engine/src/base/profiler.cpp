@@ -0,0 +1,89 @@
+// Copyright 2019 Google LLC & Bastiaan Konings
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "profiler.hpp"
+
+#include <algorithm>
+
+#include "../main.hpp"
+
+namespace blunted {
+
+  static const char *sectionNames[e_ProfileSection_SIZE] = {
+    "step",
+    "match",
+    "match/ball_collisions",
+    "match/referee",
+    "match/ball",
+    "match/mental_image",
+    "match/team",
+    "match/team/ai_controller",
+    "match/officials",
+    "match/possession_stats",
+    "match/humanoid_collisions",
+    "match/goals",
+  };
+
+  Profiler::Profiler() {
+    for (int i = 0; i < e_ProfileSection_SIZE; i++) {
+      AddSection(sectionNames[i]);
+    }
+  }
+
+  int Profiler::AddSection(const std::string &name) {
+    for (unsigned int i = 0; i < sections.size(); i++) {
+      if (sections[i].name == name) return i;
+    }
+    sections.push_back(Section());
+    sections.back().name = name;
+    return sections.size() - 1;
+  }
+
+  void Profiler::Record(int section, std::chrono::steady_clock::duration duration) {
+    Section &target = sections[section];
+    double duration_ms = std::chrono::duration<double, std::milli>(duration).count();
+    target.count++;
+    target.total_ms += duration_ms;
+    target.max_ms = std::max(target.max_ms, duration_ms);
+    long duration_us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    int bucket = 0;
+    while (duration_us > 0 && bucket < histogramSize - 1) {
+      duration_us >>= 1;
+      bucket++;
+    }
+    target.histogram[bucket]++;
+  }
+
+  void Profiler::Reset() {
+    for (auto &section : sections) {
+      std::string name = section.name;
+      section = Section();
+      section.name = name;
+    }
+  }
+
+  ProfileScope::ProfileScope(int section) : section(section) {
+    Profiler &contextProfiler = GetContext().profiler;
+    if (contextProfiler.IsEnabled() && section >= 0) {
+      profiler = &contextProfiler;
+      start = std::chrono::steady_clock::now();
+    }
+  }
+
+  ProfileScope::~ProfileScope() {
+    if (profiler) {
+      profiler->Record(section, std::chrono::steady_clock::now() - start);
+    }
+  }
+
+}
@@ -0,0 +1,93 @@
+// Copyright 2019 Google LLC & Bastiaan Konings
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _HPP_PROFILER
+#define _HPP_PROFILER
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace blunted {
+
+  // Fixed sections of the engine. Task sequence entries register further
+  // sections at runtime (see Profiler::AddSection).
+  enum e_ProfileSection {
+    e_ProfileSection_Step,
+    e_ProfileSection_Match,
+    e_ProfileSection_BallCollisions,
+    e_ProfileSection_Referee,
+    e_ProfileSection_Ball,
+    e_ProfileSection_MentalImage,
+    e_ProfileSection_Team,
+    e_ProfileSection_TeamAIController,
+    e_ProfileSection_Officials,
+    e_ProfileSection_PossessionStats,
+    e_ProfileSection_HumanoidCollisions,
+    e_ProfileSection_Goals,
+    e_ProfileSection_SIZE
+  };
+
+  // Time spent in sections of the engine, collected only while enabled.
+  // Each context has its own profiler.
+  class Profiler {
+
+    public:
+      // Durations histogram: bucket 0 counts durations under 1 us, bucket i
+      // those in [2^(i-1), 2^i) us, the last one everything longer.
+      static const int histogramSize = 20;
+
+      struct Section {
+        std::string name;
+        unsigned long count = 0;
+        double total_ms = 0.0;
+        double max_ms = 0.0;
+        unsigned long histogram[histogramSize] = { 0 };
+      };
+
+      Profiler();
+
+      void SetEnabled(bool enabled) { this->enabled = enabled; }
+      bool IsEnabled() const { return enabled; }
+      // Returns the section of the given name, adding it if needed.
+      int AddSection(const std::string &name);
+      void Record(int section, std::chrono::steady_clock::duration duration);
+      // Clears collected statistics, sections stay registered.
+      void Reset();
+      const std::vector<Section> &GetSections() const { return sections; }
+
+    private:
+      bool enabled = false;
+      std::vector<Section> sections;
+
+  };
+
+  // Records time until the end of the scope into a section of the current
+  // context's profiler. Does nothing if the profiler is disabled or the
+  // section is negative.
+  class ProfileScope {
+
+    public:
+      ProfileScope(int section);
+      ~ProfileScope();
+
+    private:
+      Profiler *profiler = nullptr;
+      int section;
+      std::chrono::steady_clock::time_point start;
+
+  };
+
+}
+
+#endif
@@ -24,6 +24,8 @@
 #define BOOST_FILESYSTEM_NO_DEPRECATED
 #include <boost/filesystem.hpp>
 
+class EnvState;
+
 namespace blunted {
 
   class Vector3;
@@ -113,6 +115,8 @@ namespace blunted {
         values.clear();
       }
 
+      void ProcessState(EnvState *state);
+
     protected:
       unsigned int maxTime_ms = 0;
       std::list<T> values;
@@ -65,9 +65,14 @@ namespace blunted {
   void Exit() {
     GetContext().scene_manager.Exit();
     GetContext().object_factory.Exit();
+    // Textures (and the other resources) need their renderer on destruction.
+    GetContext().geometry_manager.RemoveUnused();
+    GetContext().surface_manager.RemoveUnused();
+    GetContext().texture_manager.RemoveUnused();
+    GetContext().vertices_manager.RemoveUnused();
     GetContext().system_manager.Exit();
+    // SDL itself is shared by all the contexts living in the process.
     TTF_Quit();
-    SDL_Quit();
   }
 
 
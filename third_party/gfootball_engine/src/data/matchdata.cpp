@@ -112,6 +112,12 @@ MatchData::~MatchData() {
   delete teamData[1];
 }
 
+void MatchData::ProcessState(EnvState *state) {
+  state->Process(goalCount);
+  state->Process(possession60seconds);
+  state->Process(shots);
+}
+
 void MatchData::AddPossessionTime_10ms(int teamID) {
   if (teamID == 0) possession60seconds = std::max(possession60seconds - 0.01f, -60.0f);
   else if (teamID == 1) possession60seconds = std::min(possession60seconds + 0.01f, 60.0f);
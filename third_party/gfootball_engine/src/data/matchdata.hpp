@@ -40,6 +40,7 @@ class MatchData {
        // should be based on irl possession time instead of gametime? not sure
        // yet, think about this)
     void AddShot(int teamID) { shots[teamID] += 1; }
+    void ProcessState(EnvState *state);
 
    protected:
     TeamData *teamData[2];
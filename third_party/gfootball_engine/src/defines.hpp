@@ -174,6 +174,42 @@ struct SharedInfo {
   bool done = false;
 };
 
+// Fixed-layout version of SharedInfo, written by the engine into a
+// preallocated buffer which python views without copying (as numpy array).
+// All the fields are floats in environment coordinates, so the structure has
+// no padding. Any change here has to be reflected in the python dtype
+// (gfootball/env/observation_buffer.py).
+struct RawPlayerInfo {
+  float position[2];
+  float direction[2];
+  float tired_factor;
+  float has_card;
+  float is_active;
+  float role;
+};
+
+struct RawObservation {
+  float ball_position[3];
+  float ball_direction[3];
+  float ball_rotation[3];
+  float ball_owned_team;
+  float ball_owned_player;
+  float left_team_size;
+  float right_team_size;
+  RawPlayerInfo left_team[MAX_PLAYERS];
+  RawPlayerInfo right_team[MAX_PLAYERS];
+  float left_controlled_player[MAX_PLAYERS];
+  float right_controlled_player[MAX_PLAYERS];
+  float left_goals;
+  float right_goals;
+  float game_mode;
+  float is_in_play;
+  float done;
+};
+
+static_assert(sizeof(RawObservation) % sizeof(float) == 0,
+              "RawObservation must consist of floats only");
+
 namespace blunted {
 
   using namespace boost;
@@ -18,6 +18,7 @@
 #include "scheduler.hpp"
 
 #include "../base/log.hpp"
+#include "../gamedefines.hpp"
 #include "../main.hpp"
 #include "../managers/environmentmanager.hpp"
 
@@ -30,6 +31,10 @@ namespace blunted {
   Scheduler::~Scheduler() {
   }
 
+  void Scheduler::Exit() {
+    sequences.clear();
+  }
+
   int Scheduler::GetSequenceCount() {
     int size = sequences.size();
     return size;
@@ -81,6 +86,21 @@ namespace blunted {
     return info;
   }
 
+  void Scheduler::ProcessState(EnvState *state) {
+    state->Process(previousTime_ms);
+    state->Verify(sequences.size());
+    for (auto program : sequences) {
+      state->Verify(program->taskSequence->GetEntryCount());
+      state->Process(program->programCounter);
+      state->Process(program->previousProgramCounter);
+      state->Process(program->sequenceStartTime);
+      state->Process(program->lastSequenceTime);
+      state->Process(program->startTime);
+      state->Process(program->timesRan);
+      state->Process(program->readyToQuit);
+    }
+  }
+
   bool Scheduler::Run() {
 
     unsigned int firstSequence = 0;
@@ -186,7 +206,9 @@ namespace blunted {
               dueEntry.program->sequenceStartTime = time_ms;
             }
 
-            dueEntry.program->taskSequence->GetEntry(dueEntry.program->programCounter)->Execute();
+            const boost::shared_ptr<ITaskSequenceEntry> &entry = dueEntry.program->taskSequence->GetEntry(dueEntry.program->programCounter);
+            ProfileScope profileScope(entry->GetProfileSection());
+            entry->Execute();
 
             dueEntry.program->previousProgramCounter = dueEntry.program->programCounter;
             dueEntry.program->programCounter++;
@@ -24,6 +24,8 @@
 #include "../types/iusertask.hpp"
 #include "tasksequence.hpp"
 
+class EnvState;
+
 namespace blunted {
 
   struct TaskSequenceProgram {
@@ -68,6 +70,9 @@ namespace blunted {
       Scheduler();
       virtual ~Scheduler();
 
+      /// releases all the sequences (and so the tasks they run)
+      void Exit();
+
       int GetSequenceCount();
       void RegisterTaskSequence(boost::shared_ptr<TaskSequence> sequence);
       void ResetTaskSequenceTime(const std::string &name);
@@ -77,6 +82,8 @@ namespace blunted {
       /// invoke due user tasks with an Execute() call
       bool Run();
 
+      void ProcessState(EnvState *state);
+
     protected:
       unsigned long previousTime_ms = 0;
       std::vector < boost::shared_ptr<TaskSequenceProgram> > sequences;
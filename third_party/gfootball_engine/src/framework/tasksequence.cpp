@@ -19,6 +19,7 @@
 
 #include "../framework/scheduler.hpp"
 #include "../blunted.hpp"
+#include "../main.hpp"
 
 namespace blunted {
 
@@ -108,6 +109,7 @@ namespace blunted {
         break;
     }
     boost::shared_ptr<TaskSequenceEntry_SystemTaskMessage> taskSequenceEntry(new TaskSequenceEntry_SystemTaskMessage(message));
+    taskSequenceEntry->SetProfileSection(GetContext().profiler.AddSection(name));
 
     AddEntry(taskSequenceEntry);
   }
@@ -132,6 +134,7 @@ namespace blunted {
         break;
     }
     boost::shared_ptr<TaskSequenceEntry_UserTaskMessage> taskSequenceEntry(new TaskSequenceEntry_UserTaskMessage(message));
+    taskSequenceEntry->SetProfileSection(GetContext().profiler.AddSection(name));
 
     AddEntry(taskSequenceEntry);
   }
@@ -146,7 +149,7 @@ namespace blunted {
     return entries.size();
   }
 
-  boost::shared_ptr<ITaskSequenceEntry> TaskSequence::GetEntry(int num) {
+  const boost::shared_ptr<ITaskSequenceEntry> &TaskSequence::GetEntry(int num) const {
     assert(num < (signed int)entries.size());
     return entries.at(num);
   }
@@ -35,7 +35,12 @@ namespace blunted {
       virtual bool Execute() = 0;
       virtual bool IsReady() = 0;
 
+      // Profiler section the execution is recorded into, -1 if none.
+      int GetProfileSection() const { return profileSection; }
+      void SetProfileSection(int section) { profileSection = section; }
+
     protected:
+      int profileSection = -1;
 
   };
 
@@ -102,7 +107,7 @@ namespace blunted {
       void AddTerminator();
 
       int GetEntryCount() const;
-      boost::shared_ptr<ITaskSequenceEntry> GetEntry(int num);
+      const boost::shared_ptr<ITaskSequenceEntry> &GetEntry(int num) const;
       int GetSequenceTime() const;
       const std::string GetName() const;
       bool GetSkippable() const { return skipOnTooLate; }
@@ -19,11 +19,16 @@
 #include "gamedefines.hpp"
 
 #include <cmath>
+#include <cstring>
 
 #include "base/log.hpp"
 #include "base/utils.hpp"
 #include "file.h"
 #include "main.hpp"
+#include "onthepitch/match.hpp"
+
+// Bump whenever the layout of the saved state changes.
+constexpr int envStateVersion = 1;
 
 struct index3 {
   int index[3];
@@ -141,3 +146,131 @@ e_PlayerRole GetRoleFromString(const std::string &roleString) {
   if (roleString.compare("CF") == 0) return e_PlayerRole_CF;
   return e_PlayerRole_CM;  // default
 }
+
+EnvState::EnvState(Match *match) : match(match) {
+  Init(match);
+}
+
+EnvState::EnvState(Match *match, const std::string &state)
+    : BinaryStream(state), match(match) {
+  Init(match);
+}
+
+void EnvState::Init(Match *match) {
+  match->GetTeam(0)->GetAllPlayers(players);
+  match->GetTeam(1)->GetAllPlayers(players);
+  Verify(envStateVersion);
+  Verify(players.size());
+  Verify(match->GetAnimCollection()->GetAnimations().size());
+}
+
+void EnvState::Verify(int value) {
+  int saved = value;
+  Process(saved);
+  if (saved != value) failed = true;
+}
+
+int EnvState::ProcessIndex(int index, int count) {
+  Process(index);
+  if (index < -1 || index >= count) {
+    failed = true;
+    return -1;
+  }
+  return index;
+}
+
+void EnvState::Process(Player *&value) {
+  int index = -1;
+  if (!load) {
+    auto it = std::find(players.begin(), players.end(), value);
+    if (it != players.end()) index = it - players.begin();
+  }
+  index = ProcessIndex(index, players.size());
+  if (load) value = index == -1 ? nullptr : players[index];
+}
+
+void EnvState::Process(Animation *&value) {
+  const std::vector<Animation*> &animations =
+      match->GetAnimCollection()->GetAnimations();
+  int index = -1;
+  if (!load) {
+    if (animIndices.empty()) {
+      for (unsigned int i = 0; i < animations.size(); i++) {
+        animIndices[animations[i]] = i;
+      }
+    }
+    auto it = animIndices.find(value);
+    if (it != animIndices.end()) index = it->second;
+  }
+  index = ProcessIndex(index, animations.size());
+  if (load) value = index == -1 ? nullptr : animations[index];
+}
+
+void EnvState::Process(const MentalImage *&value) {
+  int count = mentalImages ? mentalImages->size() : 0;
+  int index = -1;
+  if (!load && mentalImages) {
+    auto it = std::find(mentalImages->begin(), mentalImages->end(), value);
+    if (it != mentalImages->end()) index = it - mentalImages->begin();
+  }
+  index = ProcessIndex(index, count);
+  if (load) value = index == -1 ? nullptr : (*mentalImages)[index];
+}
+
+void EnvState::Process(TouchInfo &value) {
+  Process(value.inputDirection);
+  Process(value.inputPower);
+  Process(value.autoDirectionBias);
+  Process(value.autoPowerBias);
+  Process(value.desiredDirection);
+  Process(value.desiredPower);
+  Process(value.targetPlayer);
+  Process(value.forcedTargetPlayer);
+}
+
+void EnvState::Process(PlayerCommand &value) {
+  Process(value.desiredFunctionType);
+  Process(value.useDesiredMovement);
+  Process(value.desiredDirection);
+  Process(value.strictMovement);
+  Process(value.desiredVelocityFloat);
+  Process(value.useDesiredLookAt);
+  Process(value.desiredLookAt);
+  Process(value.useTouchInfo);
+  Process(value.touchInfo);
+  Process(value.onlyDeflectAnimsThatPickupBall);
+  Process(value.useTripType);
+  Process(value.tripType);
+  Process(value.useDesiredTripDirection);
+  Process(value.desiredTripDirection);
+  Process(value.useSpecialVar1);
+  Process(value.specialVar1);
+  Process(value.useSpecialVar2);
+  Process(value.specialVar2);
+  Process(value.modifier);
+}
+
+void EnvState::Process(FormationEntry &value) {
+  Process(value.role);
+  Process(value.databasePosition);
+  Process(value.position);
+  Process(value.start_position);
+  Process(value.lazy);
+}
+
+void EnvState::Process(PlayerImage &value) {
+  Process(value.position);
+  Process(value.directionVec);
+  Process(value.movement);
+  Process(value.player);
+  Process(value.velocity);
+  Process(value.dynamicFormationEntry);
+}
+
+namespace blunted {
+  template <typename T> void ValueHistory<T>::ProcessState(EnvState *state) {
+    state->Process(values);
+  }
+
+  template void ValueHistory<float>::ProcessState(EnvState *state);
+}
@@ -20,6 +20,9 @@
 
 #include "defines.hpp"
 
+#include <set>
+
+#include "base/binarystream.hpp"
 #include "base/math/vector3.hpp"
 
 #include "wrap_SDL.h" // for key ids
@@ -300,6 +303,50 @@ struct ForceSpot {
   float scale = 0.0f; // scaled #meters until effect is almost decimated
 };
 
+class Match;
+class MentalImage;
+namespace blunted {
+  class Animation;
+}
+
+// Binary snapshot of the simulation state. Saving and loading share the same
+// ProcessState() code path: every object passes its fields to Process(),
+// which either appends them to the state or reads them back from it.
+// Pointers to players, animations and mental images are stored as indices,
+// so a state can be restored into any match with the same setup.
+class EnvState : public BinaryStream<EnvState> {
+  public:
+    // Starts saving the state of the given match.
+    EnvState(Match *match);
+    // Starts loading the given state into the match.
+    EnvState(Match *match, const std::string &state);
+
+    using BinaryStream<EnvState>::Process;
+    // Saves the value, or checks that it is equal to the saved one.
+    void Verify(int value);
+    const std::string &GetState() const { return GetData(); }
+    void SetMentalImages(const std::vector<MentalImage*> *images) { mentalImages = images; }
+
+    void Process(Player *&value);
+    void Process(Animation *&value);
+    void Process(const MentalImage *&value);
+    void Process(TouchInfo &value);
+    void Process(PlayerCommand &value);
+    void Process(FormationEntry &value);
+    void Process(PlayerImage &value);
+
+  private:
+    void Init(Match *match);
+    // Stores 'index' of an object from a table of size 'count' (-1 for null).
+    // Returns -1 if the stored index is invalid.
+    int ProcessIndex(int index, int count);
+
+    Match *match;
+    std::vector<Player*> players;
+    std::map<Animation*, int> animIndices;
+    const std::vector<MentalImage*> *mentalImages = nullptr;
+};
+
 void GetVertexColors(std::map<Vector3, Vector3> &colorCoords);
 
 e_FunctionType StringToFunctionType(const std::string &fun);
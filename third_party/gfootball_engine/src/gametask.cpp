@@ -117,23 +117,26 @@ void GameTask::PutPhase() {
   if (match) {
     match->FetchPutBuffers();
     match->Put();
-    std::vector<Player*> players;
-    match->GetActiveTeamPlayers(0, players);
-    match->GetActiveTeamPlayers(1, players);
-    std::vector<PlayerBase*> officials;
-    match->GetOfficialPlayers(officials);
-
-    for (auto player : players) {
-      if (match->GetPause() || player->NeedsModelUpdate()) {
-        player->UpdateFullbodyModel();
-        boost::static_pointer_cast<Geometry>(player->GetFullbodyNode()->GetObject("fullbody"))->OnUpdateGeometryData();
+    // full body models and goal netting are visual only
+    if (!GetGameConfig().physics_only) {
+      std::vector<Player*> players;
+      match->GetActiveTeamPlayers(0, players);
+      match->GetActiveTeamPlayers(1, players);
+      std::vector<PlayerBase*> officials;
+      match->GetOfficialPlayers(officials);
+
+      for (auto player : players) {
+        if (match->GetPause() || player->NeedsModelUpdate()) {
+          player->UpdateFullbodyModel();
+          boost::static_pointer_cast<Geometry>(player->GetFullbodyNode()->GetObject("fullbody"))->OnUpdateGeometryData();
+        }
       }
+      for (auto official : officials) {
+        official->UpdateFullbodyModel();
+        boost::static_pointer_cast<Geometry>(official->GetFullbodyNode()->GetObject("fullbody"))->OnUpdateGeometryData();
+      }
+      match->UploadGoalNetting(); // won't this block the whole process thing too? (opengl busy == wait, while mutex locked == no process)
     }
-    for (auto official : officials) {
-      official->UpdateFullbodyModel();
-      boost::static_pointer_cast<Geometry>(official->GetFullbodyNode()->GetObject("fullbody"))->OnUpdateGeometryData();
-    }
-    match->UploadGoalNetting(); // won't this block the whole process thing too? (opengl busy == wait, while mutex locked == no process)
   } // !match
   if (menuScene) menuScene->Put();
 }
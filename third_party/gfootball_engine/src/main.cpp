@@ -171,6 +171,8 @@ void run_game(Properties* input_config) {
   // fire!
 
 void quit_game() {
+  // Sequences keep the tasks alive, they have to go while the scenes exist.
+  GetScheduler()->Exit();
   context->gameTask.reset();
   context->menuTask.reset();
 
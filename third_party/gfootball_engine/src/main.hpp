@@ -33,6 +33,7 @@
 #include "loaders/aseloader.hpp"
 #include "loaders/imageloader.hpp"
 #include "base/properties.hpp"
+#include "base/profiler.hpp"
 #include <boost/random.hpp>
 
 
@@ -51,6 +52,16 @@ struct GameConfig {
   std::string data_dir;
   // How many physics animation steps are done per single environment step.
   int physics_steps_per_frame = 10;
+  // Resolution of the rendered frames.
+  int render_resolution_x = 1280;
+  int render_resolution_y = 720;
+  // Whether to load animations from the binary animation cache,
+  // when it is up to date.
+  bool use_animation_cache = true;
+  // Run simulation only: visual parts of the match (full body models, camera,
+  // stadium, goal netting) are neither allocated nor updated. Requires
+  // disabled rendering, observations are the same as with rendering disabled.
+  bool physics_only = false;
   std::string updatePath(const std::string& path) {
     if (path[0] == '/') {
       return path;
@@ -105,6 +116,9 @@ struct ScenarioConfig {
   }
 };
 
+struct CrudeSelectionQuery;
+struct TimeToBallQuery;
+
 struct GameContext {
   GameContext() : rng(BaseGenerator(), Distribution()), rng_non_deterministic(BaseGenerator(), Distribution()) {}
   GraphicsSystem *graphicsSystem = nullptr;
@@ -135,6 +149,7 @@ struct GameContext {
   ImageLoader imageLoader;
   Scheduler scheduler;
   SceneManager scene_manager;
+  Profiler profiler;
 
   typedef boost::mt19937 BaseGenerator;
   typedef boost::uniform_real<float> Distribution;
@@ -150,9 +165,17 @@ struct GameContext {
   int playerCount = 0;
   int stablePlayerCount = 0;
   BiasedOffsets emptyOffsets;
+  // Animations and their cached positions are read-only once loaded, so
+  // multiple contexts living in the same process can share them.
   boost::shared_ptr<AnimCollection> anims;
-  std::map<Animation*, std::vector<Vector3>> animPositionCache;
+  boost::shared_ptr<std::map<Animation*, std::vector<Vector3>>> animPositionCache;
   std::map<Vector3, Vector3> colorCoords;
+#ifdef BENCHMARK_HOOKS
+  // When set, all animation selection queries get recorded into it.
+  std::vector<CrudeSelectionQuery>* animQueryLog = nullptr;
+  // When set, all team time to ball calculations get recorded into it.
+  std::vector<TimeToBallQuery>* timeToBallLog = nullptr;
+#endif
 };
 
 class Match;
@@ -17,6 +17,8 @@
 
 #include "environmentmanager.hpp"
 
+#include "../gamedefines.hpp"
+
 #include "wrap_SDL.h"
 #include <boost/thread.hpp>
 
@@ -35,4 +37,8 @@ namespace blunted {
   unsigned long EnvironmentManager::GetTime_ms() {
     return currentTime_ms;
   }
+
+  void EnvironmentManager::ProcessState(EnvState *state) {
+    state->Process(currentTime_ms);
+  }
 }
@@ -20,6 +20,8 @@
 
 #include "../defines.hpp"
 
+class EnvState;
+
 namespace blunted {
 
   class EnvironmentManager {
@@ -30,6 +32,7 @@ namespace blunted {
 
       unsigned long GetTime_ms();
       void IncrementTime_ms(int duration);
+      void ProcessState(EnvState *state);
 
      protected:
       unsigned long currentTime_ms = 0;
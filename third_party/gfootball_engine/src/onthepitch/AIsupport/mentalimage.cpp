@@ -82,6 +82,14 @@ std::vector<PlayerImagePosition> MentalImage::GetTeamPlayerImages(int teamID) co
   return result;
 }
 
+void MentalImage::ProcessState(EnvState *state) {
+  state->Process(players);
+  state->Process(ballPredictions);
+  state->Process(timeStampNeg_ms);
+  state->Process(maxDistanceDeviation);
+  state->Process(maxMovementDeviation);
+}
+
 void MentalImage::UpdateBallPredictions() {
   match->GetBall()->GetPredictionArray(ballPredictions);
 }
@@ -45,6 +45,8 @@ class MentalImage {
     void SetTimeStampNeg_ms(unsigned int history_ms) { timeStampNeg_ms = history_ms; }
     int GetTimeStampNeg_ms() const { return timeStampNeg_ms; }
 
+    void ProcessState(EnvState *state);
+
   protected:
     Match *match;
 
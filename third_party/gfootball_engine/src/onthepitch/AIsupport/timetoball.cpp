@@ -0,0 +1,287 @@
+// Copyright 2019 Google LLC & Bastiaan Konings
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "timetoball.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+// Has to follow AI_GetTimeNeededForDistance_ms step by step, as results are
+// expected to be identical.
+const unsigned int timeStep_ms = 10;
+const unsigned int changeTime_ms = 700;
+const int pathSteps = changeTime_ms / timeStep_ms;
+const float ffo = 0.1f;  // in front of foot offset (ideal ball position)
+
+void TimeToBallBatch::Clear() {
+  positionX.clear();
+  positionY.clear();
+  positionZ.clear();
+  movementX.clear();
+  movementY.clear();
+  movementZ.clear();
+  maxVelocity.clear();
+  startTime_ms.clear();
+  precise.clear();
+}
+
+int TimeToBallBatch::AddPlayer(const Vector3 &position,
+                               const Vector3 &movement, float maxVelocity,
+                               unsigned int startTime_ms, bool precise) {
+  positionX.push_back(position.coords[0]);
+  positionY.push_back(position.coords[1]);
+  positionZ.push_back(position.coords[2]);
+  movementX.push_back(movement.coords[0]);
+  movementY.push_back(movement.coords[1]);
+  movementZ.push_back(movement.coords[2]);
+  this->maxVelocity.push_back(maxVelocity);
+  this->startTime_ms.push_back(startTime_ms);
+  this->precise.push_back(precise);
+  return GetSize() - 1;
+}
+
+Vector3 TimeToBallBatch::GetPosition(int index) const {
+  return Vector3(positionX[index], positionY[index], positionZ[index]);
+}
+
+Vector3 TimeToBallBatch::GetMovement(int index) const {
+  return Vector3(movementX[index], movementY[index], movementZ[index]);
+}
+
+void TimeToBallBatch::Calculate(const Vector3 *ballPredictions) {
+  PreparePaths();
+  results.resize(GetSize());
+  for (int i = 0; i < GetSize(); i++) {
+    CalculatePlayer(i, ballPredictions, false);
+  }
+}
+
+void TimeToBallBatch::CalculateReference(const Vector3 *ballPredictions) {
+  results.resize(GetSize());
+  for (int i = 0; i < GetSize(); i++) {
+    CalculatePlayer(i, ballPredictions, true);
+  }
+}
+
+void TimeToBallBatch::PreparePaths() {
+  int size = GetSize() * pathSteps;
+  moving.resize(GetSize());
+  stepX.resize(size);
+  stepY.resize(size);
+  pathX.resize(size);
+  pathY.resize(size);
+  pathZ.resize(GetSize());
+  radiusUsual.resize(size);
+  radiusOptimistic.resize(size);
+  radiusUsualSquared.resize(size);
+  radiusOptimisticSquared.resize(size);
+
+  // Movement steps and reach radii don't depend on the player's position,
+  // so they are calculated for all the players in one pass.
+  for (int s = 0; s < pathSteps; s++) {
+    unsigned int currentTime_ms = s * timeStep_ms;
+    float bias = clamp((float)currentTime_ms / (float)changeTime_ms, 0.0f, 1.0f);
+    for (int i = 0; i < GetSize(); i++) {
+      int offset = i * pathSteps + s;
+      stepX[offset] = movementX[i] * (1.0f - bias) * timeStep_ms * 0.001f;
+      stepY[offset] = movementY[i] * (1.0f - bias) * timeStep_ms * 0.001f;
+      float adaptedMaxVelocity = maxVelocity[i] * 0.94f;
+      float previousUsual = s == 0 ? 0.28f : radiusUsual[offset - 1];
+      float previousOptimistic = s == 0 ? 0.9f : radiusOptimistic[offset - 1];
+      radiusUsual[offset] =
+          previousUsual + adaptedMaxVelocity * bias * timeStep_ms * 0.001f;
+      radiusOptimistic[offset] =
+          previousOptimistic + adaptedMaxVelocity * bias * timeStep_ms * 0.001f;
+      radiusUsualSquared[offset] = radiusUsual[offset] * radiusUsual[offset];
+      radiusOptimisticSquared[offset] =
+          radiusOptimistic[offset] * radiusOptimistic[offset];
+    }
+  }
+
+  // Moving players start from a fixed point, so their whole path is known.
+  // Idle ones first step towards the target, so they are simulated per
+  // target instead.
+  for (int i = 0; i < GetSize(); i++) {
+    Vector3 movement = GetMovement(i);
+    moving[i] = movement.GetLength() > idleDribbleSwitch;
+    if (!moving[i]) continue;
+    Vector3 currentPos = GetPosition(i);
+    currentPos += movement.GetNormalized() * ffo;
+    currentPos += movement * 0.01f;
+    pathZ[i] = currentPos.coords[2];
+    for (int s = 0; s < pathSteps; s++) {
+      int offset = i * pathSteps + s;
+      currentPos.coords[0] += stepX[offset];
+      currentPos.coords[1] += stepY[offset];
+      pathX[offset] = currentPos.coords[0];
+      pathY[offset] = currentPos.coords[1];
+    }
+  }
+}
+
+TimeNeeded TimeToBallBatch::GetTimeNeeded(int index, const Vector3 &targetPos,
+                                          int maxTime_ms) const {
+  TimeNeeded result;
+  Vector3 playerPos = GetPosition(index);
+
+  float optimizeDist = 16.0f;
+  if (precise[index]) optimizeDist = 48.0f;
+
+  float initialDist = (playerPos - targetPos).GetLength();
+  unsigned int defaultOptimizedTime_ms = int(
+      std::round((targetPos - (playerPos + GetMovement(index) * 0.2f)).GetLength() /
+                 (maxVelocity[index] * 0.75f) * 1000));
+  if (initialDist > optimizeDist) {
+    result.usual_ms = defaultOptimizedTime_ms;
+    result.optimistic_ms = result.usual_ms - 200;
+    return result;
+  }
+
+  // Squared distances to the target along the path, up to the first step
+  // past maxTime_ms.
+  int steps = std::min(pathSteps, maxTime_ms / (int)timeStep_ms + 2);
+  const int first = index * pathSteps;
+  float distances[pathSteps];
+  Vector3 currentPos;
+  if (moving[index]) {
+    const float *x = &pathX[first];
+    const float *y = &pathY[first];
+    float z = targetPos.coords[2] - pathZ[index];
+    for (int s = 0; s < steps; s++) {
+      float dx = targetPos.coords[0] - x[s];
+      float dy = targetPos.coords[1] - y[s];
+      distances[s] = dx * dx + dy * dy + z * z;
+    }
+    currentPos = Vector3(x[steps - 1], y[steps - 1], pathZ[index]);
+  } else {
+    currentPos = playerPos;
+    currentPos += (targetPos - playerPos).GetNormalized(0) * ffo;
+    for (int s = 0; s < steps; s++) {
+      currentPos.coords[0] += stepX[first + s];
+      currentPos.coords[1] += stepY[first + s];
+      distances[s] = (targetPos - currentPos).GetSquaredLength();
+    }
+  }
+
+  unsigned int currentTime_ms = 0;
+  float resultingRadius_usual = 0.28f;
+  bool foundOptimisticTime = false;
+  bool found = false;
+  for (int s = 0; s < steps; s++) {
+    bool late = currentTime_ms > (unsigned int)maxTime_ms;
+    if ((distances[s] < radiusOptimisticSquared[first + s] || late) &&
+        !foundOptimisticTime) {
+      result.optimistic_ms = currentTime_ms;
+      foundOptimisticTime = true;
+    }
+    if (distances[s] < radiusUsualSquared[first + s] || late) {
+      resultingRadius_usual = radiusUsual[first + s];
+      result.usual_ms = currentTime_ms;
+      found = true;
+      break;
+    }
+    currentTime_ms += timeStep_ms;
+  }
+
+  if (!found) {
+    // Only possible when the whole path got simulated: the rest of the way
+    // is run at full speed.
+    float adaptedMaxVelocity = maxVelocity[index] * 0.94f;
+    float radius_usual = radiusUsual[first + pathSteps - 1];
+    float radius_optimistic = radiusOptimistic[first + pathSteps - 1];
+    float remainingDistance_usual = clamp((targetPos - currentPos).GetLength() - radius_usual, 0.0f, 100000.0f);
+    result.usual_ms = currentTime_ms + (remainingDistance_usual / adaptedMaxVelocity) * 1000;
+    resultingRadius_usual = radius_usual + remainingDistance_usual;
+    if (!foundOptimisticTime) {
+      float remainingDistance_optimistic = clamp((targetPos - currentPos).GetLength() - radius_optimistic, 0.0f, 100000.0f);
+      result.optimistic_ms = currentTime_ms + (remainingDistance_optimistic / adaptedMaxVelocity) * 1000;
+    }
+  }
+
+  if (currentTime_ms > (unsigned int)maxTime_ms) {
+    result.usual_ms = std::max(defaultOptimizedTime_ms, (currentTime_ms + 100) * 2);
+    if (!foundOptimisticTime) result.optimistic_ms = result.usual_ms;
+    return result;
+  }
+
+  if (result.usual_ms == 0) {
+    result.usual_ms = int(std::round(
+        clamp((targetPos - playerPos).GetLength() / resultingRadius_usual, 0.0f,
+              1.0f) *
+        10));
+    result.optimistic_ms = result.usual_ms;
+  }
+  return result;
+}
+
+void TimeToBallBatch::CalculatePlayer(int index,
+                                      const Vector3 *ballPredictions,
+                                      bool reference) {
+  Vector3 position = GetPosition(index);
+  Vector3 movement = GetMovement(index);
+  TimeNeeded &result = results[index];
+
+  // default
+  result.usual_ms = std::max(
+      ballPredictionSize_ms,
+      (unsigned int)(std::round(
+          (ballPredictions[ballPredictionSize_ms / 10 - 1].Get2D() -
+           (position + movement * 0.2f))
+              .GetLength() /
+          (maxVelocity[index] * 0.75f) * 1000)));
+  result.optimistic_ms = result.usual_ms;
+
+  bool refine = false;
+  unsigned int timeStep_ms = 10;
+  unsigned int previous_ms = 0;
+  for (unsigned int ms = startTime_ms[index]; ms < ballPredictionSize_ms; ms += timeStep_ms) {
+    const Vector3 &ball = ballPredictions[ms / 10];
+    if (ball.coords[2] < 1.5f) {
+      TimeNeeded timeNeeded =
+          reference ? AI_GetTimeNeededForDistance_ms(
+                          position, movement, ball.Get2D(),
+                          maxVelocity[index], precise[index], ms)
+                    : GetTimeNeeded(index, ball.Get2D(), ms);
+
+      if (timeNeeded.optimistic_ms <= ms) {
+        if (ms < result.optimistic_ms) result.optimistic_ms = ms;
+      }
+
+      if (timeNeeded.usual_ms <= ms) {
+        // refinement round!
+        if (!refine) {
+          ms = previous_ms;
+          timeStep_ms = 10;
+          refine = true;
+        } else {
+          result.usual_ms = ms;
+          break;
+        }
+      }
+    }
+
+    // refine timestep (optimisation)
+    if (!refine) {
+      float balldist = (position - ballPredictions[ms / 10].Get2D()).GetLength() + 0.2f; // add a little buffer
+      float maxBallVelo = 50;
+      // how long does it take for the ball at max velo to travel balldist?
+      unsigned int timeToGo_ms =
+          int(std::round((balldist / maxBallVelo) * 1000.0f));
+      timeStep_ms = clamp(timeToGo_ms, 10, 500);
+      // round to 10s
+      timeStep_ms = (timeStep_ms / 10) * 10;
+    } else timeStep_ms = 10;
+
+    previous_ms = ms;
+  }
+}
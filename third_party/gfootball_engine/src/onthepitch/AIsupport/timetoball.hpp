@@ -0,0 +1,79 @@
+// Copyright 2019 Google LLC & Bastiaan Konings
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _HPP_AISUPPORT_TIMETOBALL
+#define _HPP_AISUPPORT_TIMETOBALL
+
+#include "AIfunctions.hpp"
+
+#include <vector>
+
+// Calculates the times players need to get to the ball (usual and
+// optimistic, see Player::UpdatePossessionStats) for a whole team at once.
+// Player data is kept as a structure of arrays. How a player runs towards the
+// ball does not depend on where the ball is, so it is simulated once per
+// player, after which every ball position tried only needs a (vectorizable)
+// pass comparing distances along that path. Results are identical to those
+// of AI_GetTimeNeededForDistance_ms.
+class TimeToBallBatch {
+
+  public:
+    void Clear();
+    // Adds a player, returns its index in the batch. Players who are
+    // passing or shooting only look for the ball from 'startTime_ms' on.
+    int AddPlayer(const Vector3 &position, const Vector3 &movement,
+                  float maxVelocity, unsigned int startTime_ms, bool precise);
+    int GetSize() const { return maxVelocity.size(); }
+
+    // Calculates the times of all the players. 'ballPredictions' are the
+    // ballPredictionSize_ms / 10 predicted ball positions, 10 ms apart.
+    void Calculate(const Vector3 *ballPredictions);
+    // Same, calling AI_GetTimeNeededForDistance_ms for every ball position
+    // tried (reference implementation).
+    void CalculateReference(const Vector3 *ballPredictions);
+
+    const TimeNeeded &GetResult(int index) const { return results[index]; }
+
+  private:
+    Vector3 GetPosition(int index) const;
+    Vector3 GetMovement(int index) const;
+    void PreparePaths();
+    TimeNeeded GetTimeNeeded(int index, const Vector3 &targetPos,
+                             int maxTime_ms) const;
+    void CalculatePlayer(int index, const Vector3 *ballPredictions,
+                         bool reference);
+
+    std::vector<float> positionX, positionY, positionZ;
+    std::vector<float> movementX, movementY, movementZ;
+    std::vector<float> maxVelocity;
+    std::vector<unsigned int> startTime_ms;
+    std::vector<char> precise;
+
+    // Per player and simulation step (players x steps).
+    std::vector<char> moving;
+    std::vector<float> stepX, stepY;
+    std::vector<float> pathX, pathY, pathZ;
+    std::vector<float> radiusUsual, radiusOptimistic;
+    std::vector<float> radiusUsualSquared, radiusOptimisticSquared;
+
+    std::vector<TimeNeeded> results;
+
+};
+
+// Time to ball calculation recorded for benchmarking.
+struct TimeToBallQuery {
+  TimeToBallBatch batch;
+  std::vector<Vector3> ballPredictions;
+};
+
+#endif
@@ -557,6 +557,22 @@ void Ball::Put() {
   ball->SetRotation(fetchedbuf_orientationBuffer, false);
 }
 
+void Ball::ProcessState(EnvState *state) {
+  state->Process(momentum);
+  state->Process(rotation_ms);
+  state->Process(predictions);
+  state->Process(valid_predictions);
+  state->Process(orientPrediction);
+  state->Process(ballPosHistory);
+  state->Process(previousMomentum);
+  state->Process(previousPosition);
+  state->Process(positionBuffer);
+  state->Process(orientationBuffer);
+  buf_positionBuffer.ProcessState(state);
+  buf_orientationBuffer.ProcessState(state);
+  state->Process(ballTouchesNet);
+}
+
 void Ball::ResetSituation(const Vector3 &focusPos) {
   momentum = Vector3(0);
   rotation_ms = QUATERNION_IDENTITY;
@@ -55,6 +55,7 @@ class Ball {
     }
 
     void GetPredictionArray(Vector3 *target);
+    const Vector3 *GetPredictions() const { return predictions; }
     Vector3 GetMovement();
     Vector3 GetRotation();
     void Touch(const Vector3 &target);
@@ -73,6 +74,7 @@ class Ball {
     void Put();
 
     void ResetSituation(const Vector3 &focusPos);
+    void ProcessState(EnvState *state);
 
   private:
     boost::shared_ptr<Scene3D> scene3D;
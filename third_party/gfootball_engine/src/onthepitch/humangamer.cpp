@@ -44,6 +44,15 @@ int HumanGamer::GetSelectedPlayerID() const {
   if (selectedPlayer) return selectedPlayer->GetID(); else return -1;
 }
 
+void HumanGamer::ProcessState(EnvState *state) {
+  Player *player = selectedPlayer;
+  state->Process(player);
+  if (state->IsLoading()) {
+    SetSelectedPlayerID(player ? player->GetID() : -1);
+  }
+  controller->ProcessState(state);
+}
+
 void HumanGamer::SetSelectedPlayerID(int id) {
   if (selectedPlayer) {
     if (selectedPlayer->GetID() == id) return;
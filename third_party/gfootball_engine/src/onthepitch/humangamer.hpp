@@ -51,6 +51,8 @@ class HumanGamer {
 
     e_PlayerColor GetPlayerColor() const { return playerColor; }
 
+    void ProcessState(EnvState *state);
+
   protected:
     Team *team;
     IHIDevice *hid;
@@ -38,7 +38,7 @@ constexpr unsigned int camPosSize = 150;//180; //130
 boost::shared_ptr<AnimCollection> Match::GetAnimCollection() { return GetContext().anims; }
 
 const std::vector<Vector3> &Match::GetAnimPositionCache(Animation *anim) const {
-  return GetContext().animPositionCache.find(anim)->second;
+  return GetContext().animPositionCache->find(anim)->second;
 }
 
 Match::Match(MatchData *matchData, const std::vector<IHIDevice*> &controllers) : matchData(matchData), controllers(controllers) {
@@ -68,34 +68,23 @@ Match::Match(MatchData *matchData, const std::vector<IHIDevice*> &controllers) :
 
   if (!anims) {
     anims = boost::shared_ptr<AnimCollection>(new AnimCollection(GetScene3D()));
-    anims->Load();
-    // cache animation positions
-
-    const std::vector < Animation* > &animationsTmp = anims->GetAnimations();
-    for (unsigned int i = 0; i < animationsTmp.size(); i++) {
-      std::vector<Vector3> positions;
-      Animation *someAnim = animationsTmp[i];
-      Quaternion dud;
-      Vector3 position;
-      //printf("name: %s\n", someAnim->GetName().c_str());
-      for (int frame = 0; frame < someAnim->GetFrameCount(); frame++) {
-        someAnim->GetKeyFrame(player, frame, dud, position);
-        position.coords[2] = 0.0f;
-        positions.push_back(position);
-        //position.Print();
-      }
-      //printf("\n");
-      GetContext().animPositionCache.insert(std::pair < Animation*, std::vector<Vector3> >(someAnim, positions));
-    }
+    auto& positionCache = GetContext().animPositionCache;
+    positionCache.reset(new std::map<Animation*, std::vector<Vector3>>());
+    anims->Load(*positionCache);
+  }
+  if (GetContext().colorCoords.empty()) {
     GetVertexColors(GetContext().colorCoords);
   }
 
 
-  // full body model template
+  // full body model template (players get no models without it)
 
   ObjectLoader loader;
-  fullbodyNode = loader.LoadObject(GetScene3D(), "media/objects/players/fullbody.object");
-  fullbody2Node = loader.LoadObject(GetScene3D(), "media/objects/players/fullbody2.object");
+  bool physicsOnly = GetGameConfig().physics_only;
+  if (!physicsOnly) {
+    fullbodyNode = loader.LoadObject(GetScene3D(), "media/objects/players/fullbody.object");
+    fullbody2Node = loader.LoadObject(GetScene3D(), "media/objects/players/fullbody2.object");
+  }
 
   designatedPossessionPlayer = 0;
 
@@ -117,27 +106,33 @@ Match::Match(MatchData *matchData, const std::vector<IHIDevice*> &controllers) :
 
   // officials
 
-  std::string kitFilename = "media/objects/players/textures/referee_kit.png";
-  boost::intrusive_ptr<Resource<Surface> > kit =
-      GetContext().surface_manager.Fetch(kitFilename);
+  boost::intrusive_ptr<Resource<Surface> > kit;
+  if (!physicsOnly) {
+    std::string kitFilename = "media/objects/players/textures/referee_kit.png";
+    kit = GetContext().surface_manager.Fetch(kitFilename);
+  }
   officials = new Officials(this, fullbodyNode, GetContext().colorCoords, kit, anims);
 
-  dynamicNode->AddObject(officials->GetYellowCardGeom());
-  dynamicNode->AddObject(officials->GetRedCardGeom());
+  if (!physicsOnly) {
+    dynamicNode->AddObject(officials->GetYellowCardGeom());
+    dynamicNode->AddObject(officials->GetRedCardGeom());
+  }
 
 
   // camera
 
-  camera = static_pointer_cast<Camera>(
-      GetContext().object_factory.CreateObject("camera", e_ObjectType_Camera));
-  GetScene3D()->CreateSystemObjects(camera);
-  camera->Init();
-
-  camera->SetFOV(25);
-  cameraNode = boost::intrusive_ptr<Node>(new Node("cameraNode"));
-  cameraNode->AddObject(camera);
-  cameraNode->SetPosition(Vector3(40, 0, 100));
-  GetDynamicNode()->AddNode(cameraNode);
+  if (!physicsOnly) {
+    camera = static_pointer_cast<Camera>(
+        GetContext().object_factory.CreateObject("camera", e_ObjectType_Camera));
+    GetScene3D()->CreateSystemObjects(camera);
+    camera->Init();
+
+    camera->SetFOV(25);
+    cameraNode = boost::intrusive_ptr<Node>(new Node("cameraNode"));
+    cameraNode->AddObject(camera);
+    cameraNode->SetPosition(Vector3(40, 0, 100));
+    GetDynamicNode()->AddNode(cameraNode);
+  }
 
   cameraUserZoom = GetConfiguration()->GetReal("camera_zoom", _default_CameraZoom);
   cameraUserHeight = GetConfiguration()->GetReal("camera_height", _default_CameraHeight);
@@ -147,49 +142,51 @@ Match::Match(MatchData *matchData, const std::vector<IHIDevice*> &controllers) :
   autoUpdateIngameCamera = true;
 
 
-  // stadium
-  boost::intrusive_ptr<Node> tmpStadiumNode;
-  if (GetScenarioConfig().render) {
-    tmpStadiumNode = loader.LoadObject(GetScene3D(), "media/objects/stadiums/test/test.object");
-    RandomizeAdboards(tmpStadiumNode);
-  } else {
-    tmpStadiumNode = loader.LoadObject(GetScene3D(), "media/objects/stadiums/test/pitchonly.object");
-  }
-  std::list < boost::intrusive_ptr<Geometry> > stadiumGeoms;
+  // stadium, goal netting and pitch are visual only
+  if (!physicsOnly) {
+    boost::intrusive_ptr<Node> tmpStadiumNode;
+    if (GetScenarioConfig().render) {
+      tmpStadiumNode = loader.LoadObject(GetScene3D(), "media/objects/stadiums/test/test.object");
+      RandomizeAdboards(tmpStadiumNode);
+    } else {
+      tmpStadiumNode = loader.LoadObject(GetScene3D(), "media/objects/stadiums/test/pitchonly.object");
+    }
+    std::list < boost::intrusive_ptr<Geometry> > stadiumGeoms;
 
-  // split stadium geometry into multiple geometry objects, for more efficient culling
-  tmpStadiumNode->GetObjects<Geometry>(e_ObjectType_Geometry, stadiumGeoms);
-  assert(stadiumGeoms.size() != 0);
+    // split stadium geometry into multiple geometry objects, for more efficient culling
+    tmpStadiumNode->GetObjects<Geometry>(e_ObjectType_Geometry, stadiumGeoms);
+    assert(stadiumGeoms.size() != 0);
 
-  stadiumNode = boost::intrusive_ptr<Node>(new Node("stadium"));
+    stadiumNode = boost::intrusive_ptr<Node>(new Node("stadium"));
 
-  std::list < boost::intrusive_ptr<Geometry> >::iterator iter = stadiumGeoms.begin();
-  while (iter != stadiumGeoms.end()) {
-    boost::intrusive_ptr<Node> tmpNode = SplitGeometry(GetScene3D(), *iter, 24);
-    tmpNode->SetLocalMode(e_LocalMode_Absolute);
-    stadiumNode->AddNode(tmpNode);
+    std::list < boost::intrusive_ptr<Geometry> >::iterator iter = stadiumGeoms.begin();
+    while (iter != stadiumGeoms.end()) {
+      boost::intrusive_ptr<Node> tmpNode = SplitGeometry(GetScene3D(), *iter, 24);
+      tmpNode->SetLocalMode(e_LocalMode_Absolute);
+      stadiumNode->AddNode(tmpNode);
 
-    iter++;
-  }
-  tmpStadiumNode->Exit();
-  tmpStadiumNode.reset();
+      iter++;
+    }
+    tmpStadiumNode->Exit();
+    tmpStadiumNode.reset();
 
-  stadiumNode->SetLocalMode(e_LocalMode_Absolute);
-  GetScene3D()->AddNode(stadiumNode);
+    stadiumNode->SetLocalMode(e_LocalMode_Absolute);
+    GetScene3D()->AddNode(stadiumNode);
 
 
-  // goal netting
-  goalsNode = loader.LoadObject(GetScene3D(), "media/objects/stadiums/goals.object");
-  goalsNode->SetLocalMode(e_LocalMode_Absolute);
-  GetScene3D()->AddNode(goalsNode);
-  PrepareGoalNetting();
+    // goal netting
+    goalsNode = loader.LoadObject(GetScene3D(), "media/objects/stadiums/goals.object");
+    goalsNode->SetLocalMode(e_LocalMode_Absolute);
+    GetScene3D()->AddNode(goalsNode);
+    PrepareGoalNetting();
 
 
-  // pitch
-  if (GetGameConfig().high_quality) {
-    GeneratePitch(2048, 1024, 1024, 512, 2048, 1024);
-  } else {
-    GeneratePitch(1024, 512, 1024, 512, 2048, 1024);
+    // pitch
+    if (GetGameConfig().high_quality) {
+      GeneratePitch(2048, 1024, 1024, 512, 2048, 1024);
+    } else {
+      GeneratePitch(1024, 512, 1024, 512, 2048, 1024);
+    }
   }
 
 
@@ -284,17 +281,21 @@ void Match::Exit() {
   }
   mentalImages.clear();
 
-  fullbodyNode->Exit();
-  fullbodyNode.reset();
-  fullbody2Node->Exit();
-  fullbody2Node.reset();
+  if (fullbodyNode) {
+    fullbodyNode->Exit();
+    fullbodyNode.reset();
+    fullbody2Node->Exit();
+    fullbody2Node.reset();
+  }
 
   messageCaption->Exit();
   delete messageCaption;
 
   scene3D->DeleteNode(GetDynamicNode());
-  scene3D->DeleteNode(stadiumNode);
-  scene3D->DeleteNode(goalsNode);
+  if (stadiumNode) {
+    scene3D->DeleteNode(stadiumNode);
+    scene3D->DeleteNode(goalsNode);
+  }
   radar->Exit();
   delete radar;
 
@@ -640,6 +641,20 @@ void Match::UpdateIngameCamera() {
   }
 }
 
+int Match::GetControllerIndex(Player *player) const {
+  auto controller = player->GetExternalController();
+  if (!controller) {
+    return -1;
+  }
+  CHECK(controllers.size() == 2 * MAX_PLAYERS);
+  for (int x = 0; x < 2 * MAX_PLAYERS; x++) {
+    if (controllers[x] == controller->GetHIDevice()) {
+      return x % MAX_PLAYERS;
+    }
+  }
+  return -1;
+}
+
 void Match::GetState(SharedInfo *state) {
   state->done = GetMatchPhase() != e_MatchPhase_1stHalf;
   state->ball_position = ball->GetAveragePosition(5).coords;
@@ -658,32 +673,18 @@ void Match::GetState(SharedInfo *state) {
   state->right_controllers.clear();
   state->right_controllers.resize(GetScenarioConfig().right_team.size());
 
-  std::map<IHIDevice*, int> controller_mapping;
-  {
-    auto controllers = GetControllers();
-    CHECK(controllers.size() == 2 * MAX_PLAYERS);
-    for (int x = 0; x < MAX_PLAYERS; x++) {
-      controller_mapping[controllers[x]] = x;
-      controller_mapping[controllers[x + MAX_PLAYERS]] = x;
-    }
-  }
-
   for (int team_id = 0; team_id < 2; ++team_id) {
     std::vector<PlayerInfo>& team = team_id == 0
         ? state->left_team : state->right_team;
+    std::vector<ControllerInfo>& team_controllers = team_id == 0
+        ? state->left_controllers : state->right_controllers;
     team.clear();
     std::vector<Player*> players;
     GetAllTeamPlayers(team_id, players);
     for (auto player : players) {
-      auto controller = player->GetExternalController();
-      if (controller) {
-        if (team_id == 0) {
-          state->left_controllers[controller_mapping[
-              controller->GetHIDevice()]].controlled_player = team.size();
-        } else {
-          state->right_controllers[controller_mapping[
-              controller->GetHIDevice()]].controlled_player = team.size();
-        }
+      int controller = GetControllerIndex(player);
+      if (controller != -1) {
+        team_controllers[controller].controlled_player = team.size();
       }
       if (player->CastHumanoid() != NULL) {
         PlayerInfo info;
@@ -706,12 +707,162 @@ void Match::GetState(SharedInfo *state) {
   }
 }
 
+void Match::GetState(RawObservation *state) {
+  // Same conversion as Position::env_coord: float coordinates divided by
+  // the (double) field scale, then narrowed.
+  const double scale[3] = {X_FIELD_SCALE, Y_FIELD_SCALE, Z_FIELD_SCALE};
+  const float steps = GetGameConfig().physics_steps_per_frame;
+  Vector3 ball_position = ball->GetAveragePosition(5);
+  Vector3 ball_direction = ball->GetMovement() / steps;
+  Vector3 ball_rotation = ball->GetRotation() / steps;
+  for (int x = 0; x < 3; x++) {
+    state->ball_position[x] = float(ball_position.coords[x] / scale[x]);
+    state->ball_direction[x] = float(ball_direction.coords[x] / scale[x]);
+    state->ball_rotation[x] = float(ball_rotation.coords[x] / scale[x]);
+  }
+  state->ball_owned_player = -1;
+  state->ball_owned_team = -1;
+  state->left_goals = GetScore(0);
+  state->right_goals = GetScore(1);
+  state->is_in_play = IsInPlay();
+  state->game_mode = IsInSetPiece() ? referee->GetBuffer().desiredSetPiece
+                                    : e_GameMode_Normal;
+  state->done = GetMatchPhase() != e_MatchPhase_1stHalf;
+
+  for (int team_id = 0; team_id < 2; ++team_id) {
+    RawPlayerInfo* team = team_id == 0 ? state->left_team : state->right_team;
+    float* team_controllers = team_id == 0 ? state->left_controlled_player
+                                           : state->right_controlled_player;
+    std::fill(team_controllers, team_controllers + MAX_PLAYERS, -1.0f);
+    int team_size = 0;
+    std::vector<Player*> players;
+    GetAllTeamPlayers(team_id, players);
+    for (auto player : players) {
+      int controller = GetControllerIndex(player);
+      if (controller != -1) {
+        team_controllers[controller] = team_size;
+      }
+      if (player->CastHumanoid() != NULL && team_size < MAX_PLAYERS) {
+        RawPlayerInfo& info = team[team_size];
+        Vector3 position = player->GetPosition();
+        Vector3 direction = player->GetMovement() / steps;
+        for (int x = 0; x < 2; x++) {
+          info.position[x] = float(position.coords[x] / scale[x]);
+          info.direction[x] = float(direction.coords[x] / scale[x]);
+        }
+        info.tired_factor = 1 - player->GetFatigueFactorInv();
+        info.has_card = player->HasCards();
+        info.is_active = player->IsActive();
+        info.role = player->GetFormationEntry().role;
+        if (player->HasPossession() && GetLastTouchTeamID() != -1 &&
+            GetLastTouchTeam()->GetLastTouchPlayer() == player) {
+          state->ball_owned_player = team_size;
+          state->ball_owned_team = GetLastTouchTeamID();
+        }
+        team_size++;
+      }
+    }
+    std::fill(reinterpret_cast<float*>(team + team_size),
+              reinterpret_cast<float*>(team + MAX_PLAYERS), 0.0f);
+    (team_id == 0 ? state->left_team_size : state->right_team_size) =
+        team_size;
+  }
+}
+
 // THE SPICE
 
+void Match::ProcessState(EnvState* state) {
+  state->Process(previousProcessTime_ms);
+  state->Process(previousPreparePutTime_ms);
+  state->Process(previousPutTime_ms);
+  state->Process(timeSincePreviousProcess_ms);
+  state->Process(timeSincePreviousPreparePut_ms);
+  state->Process(timeSincePreviousPut_ms);
+  state->Process(iterations);
+  state->Process(matchTime_ms);
+  state->Process(actualTime_ms);
+  state->Process(buf_matchTime_ms);
+  state->Process(buf_actualTime_ms);
+  state->Process(fetchedbuf_matchTime_ms);
+  state->Process(fetchedbuf_actualTime_ms);
+  state->Process(goalScoredTimer);
+  state->Process(pause);
+  state->Process(matchPhase);
+  state->Process(inPlay);
+  state->Process(inSetPiece);
+  state->Process(goalScored);
+  state->Process(ballIsInGoal);
+  state->Process(lastGoalTeamID);
+  state->Process(lastGoalScorer);
+  state->Process(lastTouchTeamIDs);
+  state->Process(lastTouchTeamID);
+  int bestPossessionTeamID = bestPossessionTeam ? bestPossessionTeam->GetID() : -1;
+  state->Process(bestPossessionTeamID);
+  if (state->IsLoading()) {
+    if (bestPossessionTeamID < -1 || bestPossessionTeamID > 1) {
+      state->SetFailed();
+      return;
+    }
+    bestPossessionTeam = bestPossessionTeamID == -1 ? 0 : teams[bestPossessionTeamID];
+  }
+  state->Process(designatedPossessionPlayer);
+  state->Process(ballRetainer);
+  state->Process(gameOver);
+  possessionSideHistory->ProcessState(state);
+  state->Process(autoUpdateIngameCamera);
+  state->Process(cameraOrientation);
+  state->Process(cameraNodeOrientation);
+  state->Process(cameraNodePosition);
+  state->Process(cameraFOV);
+  state->Process(cameraNearCap);
+  state->Process(cameraFarCap);
+  state->Process(lastBodyBallCollisionTime_ms);
+  state->Process(camPos);
+  state->Process(excitement);
+  state->Process(previousBallPos);
+  state->Process(matchDurationFactor);
+  state->Process(matchDifficulty);
+  state->Process(_useMagnet);
+  matchData->ProcessState(state);
+
+  int mentalImageCount = mentalImages.size();
+  state->Process(mentalImageCount);
+  if (state->IsLoading()) {
+    if (state->Failed() || mentalImageCount < 0 || mentalImageCount > 30) {
+      state->SetFailed();
+      return;
+    }
+    while ((signed int)mentalImages.size() > mentalImageCount) {
+      delete mentalImages.back();
+      mentalImages.pop_back();
+    }
+    while ((signed int)mentalImages.size() < mentalImageCount) {
+      mentalImages.push_back(new MentalImage(this));
+    }
+  }
+  for (auto mentalImage : mentalImages) {
+    mentalImage->ProcessState(state);
+  }
+  state->SetMentalImages(&mentalImages);
+
+  ball->ProcessState(state);
+  referee->ProcessState(state);
+  teams[0]->ProcessState(state);
+  teams[1]->ProcessState(state);
+  officials->ProcessState(state);
+
+  if (state->IsLoading()) {
+    gameSequenceInfo = GetContext().scheduler.GetTaskSequenceInfo("game");
+    scoreboard->SetGoalCount(0, matchData->GetGoalCount(0));
+    scoreboard->SetGoalCount(1, matchData->GetGoalCount(1));
+  }
+}
+
 void Match::Get() {
 }
 
 void Match::Process() {
+  ProfileScope profileScope(e_ProfileSection_Match);
   unsigned long time_ms = GetContext().environment_manager.GetTime_ms() -
                           gameSequenceInfo.startTime_ms;
   timeSincePreviousProcess_ms = time_ms - GetPreviousProcessTime_ms();
@@ -725,30 +876,40 @@ void Match::Process() {
   if (!pause) {
 
     if (IsInPlay()) {
+      ProfileScope scope(e_ProfileSection_BallCollisions);
       CheckBallCollisions();
     }
 
 
     // HIJ IS EEN HONDELUUUL
 
-    referee->Process();
+    {
+      ProfileScope scope(e_ProfileSection_Referee);
+      referee->Process();
+    }
 
 
     // ball
 
     previousBallPos = ball->Predict(0);
-    ball->Process();
+    {
+      ProfileScope scope(e_ProfileSection_Ball);
+      ball->Process();
+    }
 
 
     // create mental images for the AI to use
 
-    MentalImage *mentalImage = new MentalImage(this);
-    mentalImage->TakeSnapshot();
-    mentalImages.insert(mentalImages.begin(), mentalImage);
-    if (mentalImages.size() > 30) {
-      MentalImage *mentalImageToDelete = mentalImages.back();
-      mentalImages.pop_back();
-      delete mentalImageToDelete;
+    {
+      ProfileScope scope(e_ProfileSection_MentalImage);
+      MentalImage *mentalImage = new MentalImage(this);
+      mentalImage->TakeSnapshot();
+      mentalImages.insert(mentalImages.begin(), mentalImage);
+      if (mentalImages.size() > 30) {
+        MentalImage *mentalImageToDelete = mentalImages.back();
+        mentalImages.pop_back();
+        delete mentalImageToDelete;
+      }
     }
 
 
@@ -758,11 +919,17 @@ void Match::Process() {
     teams[1]->UpdateSwitch();
     teams[0]->Process();
     teams[1]->Process();
-    officials->Process();
+    {
+      ProfileScope scope(e_ProfileSection_Officials);
+      officials->Process();
+    }
 
-    teams[0]->UpdatePossessionStats();
-    teams[1]->UpdatePossessionStats();
-    CalculateBestPossessionTeamID();
+    {
+      ProfileScope scope(e_ProfileSection_PossessionStats);
+      teams[0]->UpdatePossessionStats();
+      teams[1]->UpdatePossessionStats();
+      CalculateBestPossessionTeamID();
+    }
 
     if (GetBallRetainer() == 0) {
       if (GetBestPossessionTeam()) {
@@ -781,7 +948,10 @@ void Match::Process() {
       designatedPossessionPlayer = GetBallRetainer();
     }
 
-    CheckHumanoidCollisions();
+    {
+      ProfileScope scope(e_ProfileSection_HumanoidCollisions);
+      CheckHumanoidCollisions();
+    }
 
 
     // crowd excitement
@@ -822,8 +992,12 @@ void Match::Process() {
 
     // check for goals
 
-    bool t1goal = CheckForGoal(teams[0]->GetSide());
-    bool t2goal = CheckForGoal(teams[1]->GetSide());
+    bool t1goal, t2goal;
+    {
+      ProfileScope scope(e_ProfileSection_Goals);
+      t1goal = CheckForGoal(teams[0]->GetSide());
+      t2goal = CheckForGoal(teams[1]->GetSide());
+    }
     if (t1goal) ballIsInGoal = true;
     if (t2goal) ballIsInGoal = true;
     if (IsInPlay()) {
@@ -957,6 +1131,11 @@ void Match::PreparePutBuffers() {
     officials->PreparePutBuffers(snapshotTime_ms);
   }
 
+  buf_matchTime_ms = matchTime_ms;
+  buf_actualTime_ms = actualTime_ms;
+
+  if (GetGameConfig().physics_only) return;
+
   buf_cameraOrientation.SetValue(cameraOrientation, snapshotTime_ms);
   buf_cameraNodeOrientation.SetValue(cameraNodeOrientation, snapshotTime_ms);
 
@@ -974,9 +1153,6 @@ void Match::PreparePutBuffers() {
   buf_cameraFOV.SetValue(cameraFOV, snapshotTime_ms);
   buf_cameraNearCap = cameraNearCap;
   buf_cameraFarCap = cameraFarCap;
-
-  buf_matchTime_ms = matchTime_ms;
-  buf_actualTime_ms = actualTime_ms;
 }
 
 void Match::FetchPutBuffers() {
@@ -995,12 +1171,14 @@ void Match::FetchPutBuffers() {
   fetchedbuf_matchTime_ms = buf_matchTime_ms;
   fetchedbuf_actualTime_ms = buf_actualTime_ms;
 
-  fetchedbuf_cameraOrientation = buf_cameraOrientation.GetValue(putTime_ms);
-  fetchedbuf_cameraNodeOrientation = buf_cameraNodeOrientation.GetValue(putTime_ms);
-  fetchedbuf_cameraNodePosition = buf_cameraNodePosition.GetValue(putTime_ms);
-  fetchedbuf_cameraFOV = buf_cameraFOV.GetValue(putTime_ms);
-  fetchedbuf_cameraNearCap = buf_cameraNearCap;
-  fetchedbuf_cameraFarCap = buf_cameraFarCap;
+  if (!GetGameConfig().physics_only) {
+    fetchedbuf_cameraOrientation = buf_cameraOrientation.GetValue(putTime_ms);
+    fetchedbuf_cameraNodeOrientation = buf_cameraNodeOrientation.GetValue(putTime_ms);
+    fetchedbuf_cameraNodePosition = buf_cameraNodePosition.GetValue(putTime_ms);
+    fetchedbuf_cameraFOV = buf_cameraFOV.GetValue(putTime_ms);
+    fetchedbuf_cameraNearCap = buf_cameraNearCap;
+    fetchedbuf_cameraFarCap = buf_cameraFarCap;
+  }
 
   if (!GetPause()) {
     ball->FetchPutBuffers(putTime_ms);
@@ -1013,19 +1191,23 @@ void Match::FetchPutBuffers() {
 void Match::Put() {
   if (GetIterations() < 2) return; // no processes done yet (todo: this is not the correct way to measure that :p)
 
-  camera->SetPosition(Vector3(0, 0, 0), false);
-  camera->SetRotation(fetchedbuf_cameraOrientation, false);
-  cameraNode->SetPosition(fetchedbuf_cameraNodePosition, false);
+  bool physicsOnly = GetGameConfig().physics_only;
+  if (!physicsOnly) {
+    camera->SetPosition(Vector3(0, 0, 0), false);
+    camera->SetRotation(fetchedbuf_cameraOrientation, false);
+    cameraNode->SetPosition(fetchedbuf_cameraNodePosition, false);
 
-  cameraNode->SetRotation(fetchedbuf_cameraNodeOrientation, false);
-  camera->SetFOV(fetchedbuf_cameraFOV);
-  camera->SetCapping(fetchedbuf_cameraNearCap, fetchedbuf_cameraFarCap);
+    cameraNode->SetRotation(fetchedbuf_cameraNodeOrientation, false);
+    camera->SetFOV(fetchedbuf_cameraFOV);
+    camera->SetCapping(fetchedbuf_cameraNearCap, fetchedbuf_cameraFarCap);
+  }
 
   if (!GetPause()) {
-    ball->Put();
+    // humanoid poses are used by the simulation, the rest is visual only
+    if (!physicsOnly) ball->Put();
     teams[0]->Put();
     teams[1]->Put();
-    officials->Put();
+    if (!physicsOnly) officials->Put();
 
   } else { // pause
     //ProcessReplayMessages();
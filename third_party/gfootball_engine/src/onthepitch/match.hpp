@@ -132,6 +132,10 @@ class Match {
     boost::intrusive_ptr<Camera> GetCamera() { return camera; }
 
     void GetState(SharedInfo* state);
+    // Same as above, but writes into a fixed-layout buffer and converts to
+    // environment coordinates (no allocations).
+    void GetState(RawObservation* state);
+    void ProcessState(EnvState* state);
     void Get();
     void Process();
     void PreparePutBuffers();
@@ -172,6 +176,9 @@ class Match {
 
   private:
     bool CheckForGoal(signed int side);
+    // Index (within the team's agents) of the controller driving the player,
+    // -1 if the player isn't controlled externally.
+    int GetControllerIndex(Player *player) const;
 
     void CalculateBestPossessionTeamID();
     void CheckHumanoidCollisions();
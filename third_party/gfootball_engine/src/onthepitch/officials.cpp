@@ -50,26 +50,28 @@ Officials::Officials(Match *match, boost::intrusive_ptr<Node> fullbodySourceNode
   linesmen[0]->CastHumanoid()->ResetPosition(Vector3(25, -36.5, 0), Vector3(0));
   linesmen[1]->CastHumanoid()->ResetPosition(Vector3(-25, 36.5, 0), Vector3(0));
 
-  boost::intrusive_ptr<Resource<GeometryData> > geometry =
-      GetContext().geometry_manager.Fetch(
-          "media/objects/officials/yellowcard.ase", true);
-  yellowCard =
-      static_pointer_cast<Geometry>(GetContext().object_factory.CreateObject(
-          "yellowcard", e_ObjectType_Geometry));
-  GetScene3D()->CreateSystemObjects(yellowCard);
-  yellowCard->SetGeometryData(geometry);
-  yellowCard->SetLocalMode(e_LocalMode_Absolute);
-  yellowCard->SetPosition(Vector3(0, 0, -10));
-
-  geometry = GetContext().geometry_manager.Fetch(
-      "media/objects/officials/redcard.ase", true);
-  redCard =
-      static_pointer_cast<Geometry>(GetContext().object_factory.CreateObject(
-          "redcard", e_ObjectType_Geometry));
-  GetScene3D()->CreateSystemObjects(redCard);
-  redCard->SetGeometryData(geometry);
-  redCard->SetLocalMode(e_LocalMode_Absolute);
-  redCard->SetPosition(Vector3(0, 0, -10));
+  if (!GetGameConfig().physics_only) {
+    boost::intrusive_ptr<Resource<GeometryData> > geometry =
+        GetContext().geometry_manager.Fetch(
+            "media/objects/officials/yellowcard.ase", true);
+    yellowCard =
+        static_pointer_cast<Geometry>(GetContext().object_factory.CreateObject(
+            "yellowcard", e_ObjectType_Geometry));
+    GetScene3D()->CreateSystemObjects(yellowCard);
+    yellowCard->SetGeometryData(geometry);
+    yellowCard->SetLocalMode(e_LocalMode_Absolute);
+    yellowCard->SetPosition(Vector3(0, 0, -10));
+
+    geometry = GetContext().geometry_manager.Fetch(
+        "media/objects/officials/redcard.ase", true);
+    redCard =
+        static_pointer_cast<Geometry>(GetContext().object_factory.CreateObject(
+            "redcard", e_ObjectType_Geometry));
+    GetScene3D()->CreateSystemObjects(redCard);
+    redCard->SetGeometryData(geometry);
+    redCard->SetLocalMode(e_LocalMode_Absolute);
+    redCard->SetPosition(Vector3(0, 0, -10));
+  }
 }
 
 Officials::~Officials() {
@@ -88,6 +90,12 @@ void Officials::GetPlayers(std::vector<PlayerBase*> &players) {
   players.push_back(linesmen[1]);
 }
 
+void Officials::ProcessState(EnvState *state) {
+  referee->ProcessState(state);
+  linesmen[0]->ProcessState(state);
+  linesmen[1]->ProcessState(state);
+}
+
 void Officials::Process() {
   referee->Process();
   if (GetScenarioConfig().render) {
@@ -38,6 +38,8 @@ class Officials {
     virtual void FetchPutBuffers(unsigned long putTime_ms);
     virtual void Put();
 
+    void ProcessState(EnvState *state);
+
     boost::intrusive_ptr<Geometry> GetYellowCardGeom() { return yellowCard; }
     boost::intrusive_ptr<Geometry> GetRedCardGeom() { return redCard; }
 
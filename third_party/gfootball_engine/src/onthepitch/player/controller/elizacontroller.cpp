@@ -689,6 +689,12 @@ Vector3 ElizaController::GetSupportPosition_ForceField(const MentalImage *mental
   return forceFieldPosition;
 }
 
+void ElizaController::ProcessState(EnvState *state) {
+  PlayerController::ProcessState(state);
+  state->Process(lastDesiredDirection);
+  state->Process(lastDesiredVelocity);
+}
+
 void ElizaController::Reset() {
   lastDesiredDirection = Vector3(0);
   lastDesiredVelocity = 0;
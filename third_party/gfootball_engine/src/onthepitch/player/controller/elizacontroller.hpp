@@ -48,6 +48,8 @@ class ElizaController : public PlayerController {
 
     virtual void Reset();
 
+    virtual void ProcessState(EnvState *state);
+
   protected:
     void GetOnTheBallCommands(std::vector<PlayerCommand> &commandQueue, Vector3 &rawInputDirection, float &rawInputVelocity);
 
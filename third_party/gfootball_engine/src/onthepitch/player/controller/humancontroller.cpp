@@ -500,6 +500,17 @@ int HumanController::GetReactionTime_ms() {
   return IController::GetReactionTime_ms(); // already have human reaction time to contend with
 }
 
+void HumanController::ProcessState(EnvState *state) {
+  PlayerController::ProcessState(state);
+  state->Process(actionMode);
+  state->Process(actionButton);
+  state->Process(actionBufferTime_ms);
+  state->Process(gauge_ms);
+  state->Process(previousDirection);
+  state->Process(steadyDirection);
+  state->Process(lastSteadyDirectionSnapshotTime_ms);
+}
+
 void HumanController::Reset() {
   actionMode = 0;
   gauge_ms = 0;
@@ -45,6 +45,8 @@ class HumanController : public PlayerController {
 
     virtual void Reset();
 
+    virtual void ProcessState(EnvState *state);
+
   protected:
 
     void _GetHidInput(Vector3 &rawInputDirection, float &rawInputVelocityFloat);
@@ -46,6 +46,8 @@ class IController {
 
     virtual void Reset() = 0;
 
+    virtual void ProcessState(EnvState *state) {}
+
   protected:
     PlayerBase *player;
     Match *match;
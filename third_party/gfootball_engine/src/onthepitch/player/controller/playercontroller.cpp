@@ -178,6 +178,30 @@ Vector3 PlayerController::GetDefendPosition(Player *opp, float distance) {
   return target;
 }
 
+void PlayerController::ProcessState(EnvState *state) {
+  state->Process(inputDirection);
+  state->Process(inputVelocityFloat);
+  state->Process(_oppPlayer);
+  state->Process(_timeNeeded_ms);
+  state->Process(_mentalImage);
+  state->Process(lastSwitchTime_ms);
+  state->Process(lastSwitchTimeDuration_ms);
+  state->Process(hasPossession);
+  state->Process(hasUniquePossession);
+  state->Process(teamHasPossession);
+  state->Process(teamHasUniquePossession);
+  state->Process(oppTeamHasPossession);
+  state->Process(oppTeamHasUniquePossession);
+  state->Process(hasBestPossession);
+  state->Process(teamHasBestPossession);
+  state->Process(possessionAmount);
+  state->Process(teamPossessionAmount);
+  state->Process(fadingTeamPossessionAmount);
+  state->Process(timeNeededToGetToBall);
+  state->Process(oppTimeNeededToGetToBall);
+  state->Process(hasBestChanceOfPossession);
+}
+
 void PlayerController::Reset() {
 
   lastSwitchTimeDuration_ms = 0;
@@ -46,6 +46,8 @@ class PlayerController : public IController {
 
     virtual void Reset();
 
+    virtual void ProcessState(EnvState *state);
+
   protected:
     float OppBetweenBallAndMeDot();
     float CouldWinABallDuelLikeliness();
@@ -21,12 +21,25 @@
 
 #include "../../../main.hpp"
 #include "../../../scene/objectfactory.hpp"
+#include "../../../utils/animationcache.hpp"
 #include "../../../utils/animationextensions/footballanimationextension.hpp"
 #include "../../../utils/objectloader.hpp"
 #include "file.h"
 #include "humanoid.hpp"
 #include "humanoid_utils.hpp"
 
+// Binary cache of the prepared animations, relative to the data directory.
+// The build derives its version from the code which prepares and stores the
+// animations (see ANIMATION_CACHE_CODE in CMakeLists.txt), so caches written
+// by another engine version are ignored.
+#ifndef ANIMATION_CACHE_VERSION
+#error "ANIMATION_CACHE_VERSION has to be defined by the build"
+#endif
+const std::string animationCacheFile = "media/animations/animations.cache";
+constexpr uint64_t animationCacheMagic = 0x41434d494e414647ull; // GFANIMCA
+constexpr uint64_t animationCacheVersion = ANIMATION_CACHE_VERSION;
+const std::string playerObjectFile = "media/objects/players/player.object";
+
 void FillNodeMap(boost::intrusive_ptr<Node> targetNode, NodeMap &nodeMap) {
   nodeMap[BodyPartFromString(targetNode->GetName())] = targetNode;
 
@@ -102,6 +115,7 @@ void AnimCollection::Clear() {
     animIter++;
   }
   animations.clear();
+  _BuildSelectionIndex();
 }
 
 radian GetAngle(int directionID) {
@@ -347,12 +361,127 @@ void GenerateAutoAnims(const std::vector<Animation*> &templates, std::vector<Ani
   }
 }
 
-void AnimCollection::Load() {
+void AnimCollection::Load(std::map<Animation*, std::vector<Vector3>> &positionCache) {
+  std::string filename = GetGameConfig().updatePath(animationCacheFile);
+  if (!GetGameConfig().use_animation_cache || !_LoadCache(filename, positionCache)) {
+    _LoadSources(positionCache);
+  }
+  _BuildSelectionIndex();
+}
+
+bool AnimCollection::SaveCache(const std::string &filename, std::map<Animation*, std::vector<Vector3>> &positionCache) {
+  AnimationCache cache;
+  _ProcessCache(&cache, _SourceChecksum(), positionCache);
+  if (cache.Failed()) return false;
+
+  // write to a temporary file first, so that nobody reads a partial cache
+  std::string tmpFilename = filename + ".tmp";
+  std::ofstream file(tmpFilename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+  file.write(cache.GetData().data(), cache.GetData().size());
+  file.close();
+  if (!file) {
+    remove(tmpFilename.c_str());
+    return false;
+  }
+  return rename(tmpFilename.c_str(), filename.c_str()) == 0;
+}
+
+bool AnimCollection::_LoadCache(const std::string &filename, std::map<Animation*, std::vector<Vector3>> &positionCache) {
+  if (!fs::exists(filename)) return false;
+  // The animations are deserialized into the heap, the file is only read.
+  std::string data = GetFile(filename);
+  AnimationCache cache(data.data(), data.size());
+  _ProcessCache(&cache, _SourceChecksum(), positionCache);
+  if (cache.Finished()) return true;
+  Log(e_Warning, "AnimCollection", "Load", "Animation cache " + filename + " is out of date, loading animation sources instead");
+  Clear();
+  positionCache.clear();
+  return false;
+}
+
+void AnimCollection::_ProcessCache(AnimationCache *cache, uint64_t checksum, std::map<Animation*, std::vector<Vector3>> &positionCache) {
+  cache->Verify(animationCacheMagic);
+  cache->Verify(animationCacheVersion);
+  cache->Verify(checksum);
+  int count = animations.size();
+  if (!cache->ProcessSize(count)) return;
+  if (cache->IsLoading()) {
+    for (int i = 0; i < count; i++) {
+      Animation *animation = new Animation();
+      boost::shared_ptr<FootballAnimationExtension> extension(new FootballAnimationExtension(animation));
+      animation->AddExtension("football", extension);
+      animations.push_back(animation);
+    }
+  }
+  for (auto animation : animations) {
+    animation->ProcessCache(cache);
+    cache->Process(positionCache[animation]);
+    if (cache->Failed()) return;
+  }
+}
+
+void AnimCollection::_GetSourceFiles(std::vector<std::string> &templateFiles, std::vector<std::string> &animFiles) const {
+  GetFiles("media/animations/templates", "anim", templateFiles);
+  sort(templateFiles.begin(), templateFiles.end());
+
+  std::vector<std::string> files;
+  GetFiles("media/animations", "anim", files);
+  sort(files.begin(), files.end());
+
+  bool omitLuxuryAnims = true;
+
+  for (unsigned int i = 0; i < files.size(); i++) {
+    //printf("%s\n", files[i].c_str());
+    if ((omitLuxuryAnims && files[i].find("luxury") != std::string::npos) || files[i].find("templates") != std::string::npos) {
+      //printf ("ignoring\n");
+    } else {
+      animFiles.push_back(files[i]);
+    }
+  }
+}
+
+// FNV-1a
+static void HashData(uint64_t &hash, const std::string &data) {
+  for (unsigned char c : data) {
+    hash ^= c;
+    hash *= 1099511628211ull;
+  }
+}
+
+static void HashFile(uint64_t &hash, const std::string &filename) {
+  HashData(hash, fs::path(filename).filename().string());
+  if (fs::exists(filename)) {
+    HashData(hash, GetFile(filename));
+  } else {
+    HashData(hash, "missing");
+  }
+}
+
+uint64_t AnimCollection::_SourceChecksum() const {
+  std::vector<std::string> templateFiles;
+  std::vector<std::string> animFiles;
+  _GetSourceFiles(templateFiles, animFiles);
+
+  // Hashes the contents (about 2 MB), so that edited sources are noticed
+  // regardless of their modification times. The utility player is used while
+  // preparing the anims.
+  uint64_t checksum = 14695981039346656037ull;
+  HashFile(checksum, GetGameConfig().updatePath(playerObjectFile));
+  for (auto files : { &templateFiles, &animFiles }) {
+    HashData(checksum, int_to_str(files->size()));
+    for (auto &file : *files) {
+      HashFile(checksum, file);
+    }
+  }
+  return checksum;
+}
+
+void AnimCollection::_LoadSources(std::map<Animation*, std::vector<Vector3>> &positionCache) {
   // load utility player to get things like foot position in the frames around the balltouch etc.
 
   ObjectLoader loader;
   boost::intrusive_ptr<Node> playerNode;
-  playerNode = loader.LoadObject(scene3D, "media/objects/players/player.object");
+  playerNode = loader.LoadObject(scene3D, playerObjectFile);
   playerNode->SetName("player");
   playerNode->SetLocalMode(e_LocalMode_Absolute);
 
@@ -373,14 +502,14 @@ void AnimCollection::Load() {
 
   // auto generated anims
 
+  std::vector<std::string> templateFiles;
   std::vector<std::string> files;
-  GetFiles("media/animations/templates", "anim", files);
-  sort(files.begin(), files.end());
+  _GetSourceFiles(templateFiles, files);
 
   std::vector<Animation*> templates;
-  for (unsigned int i = 0; i < files.size(); i++) {
+  for (unsigned int i = 0; i < templateFiles.size(); i++) {
     Animation *animTemplate = new Animation();
-    animTemplate->Load(files[i]);
+    animTemplate->Load(templateFiles[i]);
     templates.push_back(animTemplate);
   }
 
@@ -409,58 +538,55 @@ void AnimCollection::Load() {
 
   // load all other animations
 
-  files.clear();
-  GetFiles("media/animations", "anim", files);
-  sort(files.begin(), files.end());
-
-  bool omitLuxuryAnims = true;
-
   for (unsigned int i = 0; i < files.size(); i++) {
+    for (int mirror = 0; mirror < 2; mirror++) {
+      Animation *animation = new Animation();
+      boost::shared_ptr<FootballAnimationExtension> extension(new FootballAnimationExtension(animation));
+      animation->AddExtension("football", extension);
+      animation->Load(files[i]);
+      if (mirror == 1) animation->Mirror();
 
-    //printf("%s\n", files[i].c_str());
-
-    if ((omitLuxuryAnims && files[i].find("luxury") != std::string::npos) || files[i].find("templates") != std::string::npos) {
-      //printf ("ignoring\n");
-
-    } else {
-
-      for (int mirror = 0; mirror < 2; mirror++) {
-        Animation *animation = new Animation();
-        boost::shared_ptr<FootballAnimationExtension> extension(new FootballAnimationExtension(animation));
-        animation->AddExtension("football", extension);
-        animation->Load(files[i]);
-        if (mirror == 1) animation->Mirror();
+      _PrepareAnim(animation, playerNode, bodyParts, nodeMap, false);
 
-        _PrepareAnim(animation, playerNode, bodyParts, nodeMap, false);
+      /* disabled: too many side effects, should just make the most important of these manually
 
-        /* disabled: too many side effects, should just make the most important of these manually
+      // duplicate dribble anims with > 45 degree body directions (either in or out) and convert duplicate to walking speed
+      // this is because of the decision to allow 135 degree body directions ('walking backward') on walking velocities.
+      // more correct (to get proper leg movement for walking velocities) would be to create separate anims for these, but i'm feeling lazy
+      if (animation->GetAnimType().compare(e_DefString_Movement) == 0) {
+        if (fabs(animation->GetIncomingBodyAngle()) > 0.5 * pi || fabs(animation->GetOutgoingBodyAngle()) > 0.5 * pi) {
+          if (FloatToEnumVelocity(animation->GetIncomingVelocity()) == e_Velocity_Dribble || FloatToEnumVelocity(animation->GetOutgoingVelocity()) == e_Velocity_Dribble) {
 
-        // duplicate dribble anims with > 45 degree body directions (either in or out) and convert duplicate to walking speed
-        // this is because of the decision to allow 135 degree body directions ('walking backward') on walking velocities.
-        // more correct (to get proper leg movement for walking velocities) would be to create separate anims for these, but i'm feeling lazy
-        if (animation->GetAnimType().compare(e_DefString_Movement) == 0) {
-          if (fabs(animation->GetIncomingBodyAngle()) > 0.5 * pi || fabs(animation->GetOutgoingBodyAngle()) > 0.5 * pi) {
-            if (FloatToEnumVelocity(animation->GetIncomingVelocity()) == e_Velocity_Dribble || FloatToEnumVelocity(animation->GetOutgoingVelocity()) == e_Velocity_Dribble) {
+            Animation *animation2 = new Animation();
+            boost::shared_ptr<FootballAnimationExtension> extension(new FootballAnimationExtension(animation));
+            animation2->AddExtension("football", extension);
+            animation2->Load(files[i], mirror == 0 ? false : true);
 
-              Animation *animation2 = new Animation();
-              boost::shared_ptr<FootballAnimationExtension> extension(new FootballAnimationExtension(animation));
-              animation2->AddExtension("football", extension);
-              animation2->Load(files[i], mirror == 0 ? false : true);
+            _PrepareAnim(animation2, playerNode, bodyParts, nodeMap, true);
 
-              _PrepareAnim(animation2, playerNode, bodyParts, nodeMap, true);
-
-            }
           }
-        }*/
-      }
-
+        }
+      }*/
     }
-
   }
 
   //delete baseAnim;
 
   playerNode->Exit();
+
+  // cache animation positions
+  for (unsigned int i = 0; i < animations.size(); i++) {
+    std::vector<Vector3> positions;
+    Animation *someAnim = animations[i];
+    Quaternion dud;
+    Vector3 position;
+    for (int frame = 0; frame < someAnim->GetFrameCount(); frame++) {
+      someAnim->GetKeyFrame(player, frame, dud, position);
+      position.coords[2] = 0.0f;
+      positions.push_back(position);
+    }
+    positionCache.insert(std::pair < Animation*, std::vector<Vector3> >(someAnim, positions));
+  }
 }
 
 const std::vector < Animation* > &AnimCollection::GetAnimations() const {
@@ -468,7 +594,7 @@ const std::vector < Animation* > &AnimCollection::GetAnimations() const {
 }
 
 
-void AnimCollection::CrudeSelection(DataSet &dataSet, const CrudeSelectionQuery &query) {
+void AnimCollection::CrudeSelectionLinear(DataSet &dataSet, const CrudeSelectionQuery &query) {
 
   // makes a crude selection to later refine
 
@@ -774,6 +900,269 @@ void AnimCollection::CrudeSelection(DataSet &dataSet, const CrudeSelectionQuery
   }
 }
 
+void AnimSelectionTable::Clear() {
+  *this = AnimSelectionTable();
+}
+
+void AnimSelectionTable::Add(const Animation *animation, radian maxIncomingBallDirectionDeviation, radian maxOutgoingBallDirectionDeviation) {
+  animType.push_back(animation->GetAnimType());
+  incomingVelocity.push_back(FloatToEnumVelocity(animation->GetIncomingVelocity()));
+  outgoingVelocity.push_back(FloatToEnumVelocity(animation->GetOutgoingVelocity()));
+
+  float animIncomingVelocityFloat = RangeVelocity(animation->GetIncomingVelocity());
+  float animOutgoingVelocityFloat = RangeVelocity(animation->GetOutgoingVelocity());
+  if (FloatToEnumVelocity(animIncomingVelocityFloat) == e_Velocity_Dribble) animIncomingVelocityFloat = walkVelocity;
+  if (FloatToEnumVelocity(animOutgoingVelocityFloat) == e_Velocity_Dribble) animOutgoingVelocityFloat = walkVelocity;
+  linearIncomingVelocity.push_back(animIncomingVelocityFloat);
+  linearOutgoingVelocity.push_back(animOutgoingVelocityFloat);
+
+  Vector3 incomingBodyDirection = animation->GetIncomingBodyDirection();
+  incomingBodyDirectionX.push_back(incomingBodyDirection.coords[0]);
+  incomingBodyDirectionY.push_back(incomingBodyDirection.coords[1]);
+  incomingBodyDirectionZ.push_back(incomingBodyDirection.coords[2]);
+  Vector3 outgoingDirection = animation->GetOutgoingDirection().GetRotated2D(animation->GetOutgoingBodyAngle());
+  outgoingDirectionX.push_back(outgoingDirection.coords[0]);
+  outgoingDirectionY.push_back(outgoingDirection.coords[1]);
+  outgoingDirectionZ.push_back(outgoingDirection.coords[2]);
+  Vector3 outgoingBodyDirection = Vector3(0, -1, 0).GetRotated2D(animation->GetOutgoingBodyAngle() + animation->GetOutgoingAngle());
+  outgoingBodyDirectionX.push_back(outgoingBodyDirection.coords[0]);
+  outgoingBodyDirectionY.push_back(outgoingBodyDirection.coords[1]);
+  outgoingBodyDirectionZ.push_back(outgoingBodyDirection.coords[2]);
+  turnAngle.push_back(outgoingDirection.GetAngle2D(incomingBodyDirection));
+  incomingBodyAngleAbs.push_back(fabs(FixAngle(incomingBodyDirection.GetAngle2D())));
+
+  retainsBall.push_back(animation->GetVariable("outgoing_retain_state") != "");
+  lastDitch.push_back(animation->GetVariableCache().lastditch());
+
+  Vector3 incomingBallDirection = GetVectorFromString(animation->GetVariable("incomingballdirection"));
+  incomingBallDirectionLength.push_back(incomingBallDirection.GetLength());
+  if (incomingBallDirection.GetLength() != 0.0f) {
+    incomingBallDirection.coords[2] *= 0.4f;
+    incomingBallDirection.Normalize();
+  }
+  incomingBallDirectionX.push_back(incomingBallDirection.coords[0]);
+  incomingBallDirectionY.push_back(incomingBallDirection.coords[1]);
+  incomingBallDirectionZ.push_back(incomingBallDirection.coords[2]);
+  radian maxDeviation = fabs(atof(animation->GetVariable("incomingballdirection_maxdeviation").c_str()) * pi);
+  if (maxDeviation == 0.0f) {
+    maxDeviation = maxIncomingBallDirectionDeviation;
+    if (animation->GetAnimType() == e_DefString_Deflect) maxDeviation = 0.4f * pi;
+  }
+  incomingBallMaxDeviation.push_back(maxDeviation);
+
+  Vector3 outgoingBallDirection = GetVectorFromString(animation->GetVariable("balldirection"));
+  outgoingBallDirection.Normalize(Vector3(0));
+  outgoingBallDirectionX.push_back(outgoingBallDirection.coords[0]);
+  outgoingBallDirectionY.push_back(outgoingBallDirection.coords[1]);
+  outgoingBallDirectionZ.push_back(outgoingBallDirection.coords[2]);
+  maxDeviation = fabs(atof(animation->GetVariable("outgoingballdirection_maxdeviation").c_str()) * pi);
+  if (maxDeviation == 0.0) {
+    maxDeviation = maxOutgoingBallDirectionDeviation;
+  }
+  outgoingBallMaxDeviation.push_back(maxDeviation);
+
+  tripType.push_back(int(round(atof(animation->GetVariable("triptype").c_str()))));
+
+  std::string forced = animation->GetVariable("forcedfoot");
+  int which = 0;
+  if (forced.compare("strong") == 0) which = 1;
+  else if (forced.compare("weak") == 0) which = 2;
+  forcedFoot.push_back(which);
+  e_Foot animFoot = e_Foot_Right;
+  if (animation->GetVariable("touchfoot").compare("left") == 0) animFoot = e_Foot_Left;
+  // for mirrored anims that, therefore, don't start with right foot
+  if (animation->GetCurrentFoot() == e_Foot_Left) {
+    if (animFoot == e_Foot_Left) animFoot = e_Foot_Right; else animFoot = e_Foot_Left;
+  }
+  touchFoot.push_back(animFoot);
+}
+
+void AnimCollection::_BuildSelectionIndex() {
+  selectionTable.Clear();
+  for (int velocity = 0; velocity <= e_Velocity_Sprint; velocity++) {
+    allAnimsIndex[velocity].clear();
+    for (int functionType = 0; functionType <= e_FunctionType_Special; functionType++) {
+      functionTypeIndex[functionType][velocity].clear();
+    }
+  }
+  for (unsigned int i = 0; i < animations.size(); i++) {
+    selectionTable.Add(animations[i], maxIncomingBallDirectionDeviation, maxOutgoingBallDirectionDeviation);
+    e_Velocity velocity = selectionTable.incomingVelocity[i];
+    allAnimsIndex[velocity].push_back(i);
+    for (int functionType = 0; functionType <= e_FunctionType_Special; functionType++) {
+      if (_CheckFunctionType(selectionTable.animType[i], e_FunctionType(functionType))) {
+        functionTypeIndex[functionType][velocity].push_back(i);
+      }
+    }
+  }
+}
+
+// Whether anims with given incoming velocity may be selected, ignoring the
+// linearity constraint (which also depends on the outgoing velocity).
+static bool IsIncomingVelocityAllowed(e_Velocity animIncomingVelocity, const CrudeSelectionQuery &query) {
+  if (query.byIncomingVelocity == false) return true;
+  if (query.incomingVelocity_Strict == true) return animIncomingVelocity == query.incomingVelocity;
+  if (query.incomingVelocity_NoDribbleToIdle) {
+    if (animIncomingVelocity == e_Velocity_Idle && query.incomingVelocity == e_Velocity_Dribble) return false;
+  }
+  if (animIncomingVelocity == e_Velocity_Idle && query.incomingVelocity == e_Velocity_Walk) return false;
+  if (animIncomingVelocity == e_Velocity_Idle && query.incomingVelocity == e_Velocity_Sprint) return false;
+  if (animIncomingVelocity == e_Velocity_Dribble && query.incomingVelocity == e_Velocity_Idle) return false;
+  if (animIncomingVelocity == e_Velocity_Walk && query.incomingVelocity == e_Velocity_Idle) return false;
+  if (animIncomingVelocity == e_Velocity_Sprint && query.incomingVelocity == e_Velocity_Idle) return false;
+  if (query.incomingVelocity_NoDribbleToSprint) {
+    if (animIncomingVelocity == e_Velocity_Sprint && query.incomingVelocity == e_Velocity_Dribble) return false;
+  }
+  return true;
+}
+
+void AnimCollection::CrudeSelection(DataSet &dataSet, const CrudeSelectionQuery &query) {
+
+  // same selection as CrudeSelectionLinear, but only goes through candidates
+  // with matching function type and incoming velocity, using precomputed data
+
+#ifdef BENCHMARK_HOOKS
+  if (GetContext().animQueryLog) GetContext().animQueryLog->push_back(query);
+#endif
+
+  const AnimSelectionTable &table = selectionTable;
+
+  static thread_local DataSet candidates;
+  candidates.clear();
+  int buckets = 0;
+  for (int velocity = 0; velocity <= e_Velocity_Sprint; velocity++) {
+    if (!IsIncomingVelocityAllowed(e_Velocity(velocity), query)) continue;
+    const std::vector<int> &bucket = query.byFunctionType ? functionTypeIndex[query.functionType][velocity] : allAnimsIndex[velocity];
+    if (bucket.empty()) continue;
+    candidates.insert(candidates.end(), bucket.begin(), bucket.end());
+    buckets++;
+  }
+  if (buckets > 1) std::sort(candidates.begin(), candidates.end());
+
+  // query dependent values which are the same for all candidates
+  const radian marginRadians = 0.06f * pi;
+  float queryVelocityFloat = EnumToFloatVelocity(query.incomingVelocity);
+  if (FloatToEnumVelocity(queryVelocityFloat) == e_Velocity_Dribble) queryVelocityFloat = walkVelocity;
+  const Vector3 fencedDirection = query.lookAtVecRel.GetRotated2D(pi);
+  const radian queryIncomingToFenceAngle = fencedDirection.GetAngle2D(query.incomingBodyDirection);
+  const e_Side queryIncomingToFenceSide = (queryIncomingToFenceAngle > 0) ? e_Side_Left : e_Side_Right;
+  const bool byIncomingBodyDirection = query.byIncomingBodyDirection == true && !(query.byIncomingVelocity == true && query.incomingVelocity == e_Velocity_Idle);
+  const radian queryIncomingBodyAngleAbs = fabs(FixAngle(query.incomingBodyDirection.GetAngle2D()));
+  const radian idleBodyAngle = fabs(Vector3(0, -1, 0).GetAngle2D(query.incomingBodyDirection));
+  const bool queryHasIncomingBallDirection = query.incomingBallDirection.GetLength() != 0.0f;
+  Vector3 adaptedIncomingBallDirection = query.incomingBallDirection;
+  if (queryHasIncomingBallDirection) {
+    adaptedIncomingBallDirection.coords[2] *= 0.4f;
+    adaptedIncomingBallDirection.Normalize();
+  }
+  const Vector3 outgoingBallDirection2D = query.outgoingBallDirection.Get2D();
+  const bool queryRetainsBall = query.properties.incoming_retain_state().compare("") != 0;
+
+  for (int i : candidates) {
+
+    if (query.byIncomingVelocity == true && query.incomingVelocity_Strict == false && query.incomingVelocity_ForceLinearity) {
+      // disallow going from current -> slower/faster -> current; the complete section needs to be linear
+      if (table.linearIncomingVelocity[i] > std::max(queryVelocityFloat, table.linearOutgoingVelocity[i])) continue;
+      if (table.linearIncomingVelocity[i] < std::min(queryVelocityFloat, table.linearOutgoingVelocity[i])) continue;
+    }
+
+    if (query.byOutgoingVelocity == true) {
+      if (table.outgoingVelocity[i] != query.outgoingVelocity) continue;
+    }
+
+    Vector3 incomingBodyDir(table.incomingBodyDirectionX[i], table.incomingBodyDirectionY[i], table.incomingBodyDirectionZ[i]);
+
+    if (query.bySide == true) {
+      radian animTurnAngle = table.turnAngle[i];
+      if (fabs(animTurnAngle) > 0.06f * pi) { // threshold
+        Vector3 animOutgoingDirection(table.outgoingDirectionX[i], table.outgoingDirectionY[i], table.outgoingDirectionZ[i]);
+        e_Side animSide = (animTurnAngle > 0) ? e_Side_Left : e_Side_Right;
+
+        radian animIncomingToFenceAngle = fencedDirection.GetAngle2D(incomingBodyDir);
+        radian fenceToOutgoingAngle = animOutgoingDirection.GetAngle2D(fencedDirection);
+
+        e_Side animIncomingToFenceSide = (animIncomingToFenceAngle > 0) ? e_Side_Left : e_Side_Right;
+        e_Side fenceToAnimOutgoingSide = (fenceToOutgoingAngle > 0) ? e_Side_Left : e_Side_Right;
+
+        if (animIncomingToFenceSide  == animSide && fenceToAnimOutgoingSide == animSide && fabs(animIncomingToFenceAngle + fenceToOutgoingAngle) < pi) continue;
+        if (queryIncomingToFenceSide == animSide && fenceToAnimOutgoingSide == animSide && fabs(queryIncomingToFenceSide + fenceToOutgoingAngle) < pi) continue;
+      }
+    }
+
+    if (query.byPickupBall == true) {
+      if (table.retainsBall[i] != query.pickupBall) continue;
+    }
+
+    if (query.allowLastDitchAnims == false) {
+      if (table.lastDitch[i]) continue;
+    }
+
+    if (byIncomingBodyDirection) {
+      if (table.incomingVelocity[i] != e_Velocity_Idle) {
+        if (table.incomingBodyAngleAbs[i] > queryIncomingBodyAngleAbs + marginRadians) continue;
+        radian incomingAngle = fabs(incomingBodyDir.GetAngle2D(query.incomingBodyDirection));
+        if (query.incomingBodyDirection_Strict == true) {
+          if (incomingAngle > marginRadians) continue;
+        } else {
+          if (incomingAngle > 0.5f * pi + marginRadians) continue;
+        }
+        if (query.incomingBodyDirection_ForceLinearity) {
+          Vector3 outgoingBodyDir(table.outgoingBodyDirectionX[i], table.outgoingBodyDirectionY[i], table.outgoingBodyDirectionZ[i]);
+          radian shortestAngle1 = incomingBodyDir.GetAngle2D(outgoingBodyDir);
+          radian shortestAngle2 = incomingBodyDir.GetAngle2D(query.incomingBodyDirection);
+          if ((shortestAngle1 >  marginRadians && shortestAngle2 >  marginRadians) ||
+              (shortestAngle1 < -marginRadians && shortestAngle2 < -marginRadians)) {
+            continue;
+          }
+          if (fabs(shortestAngle1) + fabs(shortestAngle2) > pi + marginRadians) continue;
+        }
+      } else {
+        if (query.incomingBodyDirection_Strict == true) {
+          if (idleBodyAngle > marginRadians) continue;
+        } else {
+          if (idleBodyAngle > 0.25f * pi + marginRadians) continue;
+        }
+      }
+    }
+
+    if (query.byIncomingBallDirection == true) {
+      if (table.incomingBallDirectionLength[i] < 0.1f) {
+        Log(e_FatalError, "AnimCollection", "Crudeselection", "Anim " + animations[i]->GetName() + " missing incoming ball direction");
+      }
+      if (table.incomingBallDirectionLength[i] != 0.0f && queryHasIncomingBallDirection) {
+        Vector3 animBallDirection(table.incomingBallDirectionX[i], table.incomingBallDirectionY[i], table.incomingBallDirectionZ[i]);
+        radian ballDirectionAngle = fabs(adaptedIncomingBallDirection.GetAngle2D(animBallDirection));
+        if (ballDirectionAngle > table.incomingBallMaxDeviation[i]) continue;
+      }
+    }
+
+    if (query.byOutgoingBallDirection == true) {
+      Vector3 animBallDirection(table.outgoingBallDirectionX[i], table.outgoingBallDirectionY[i], table.outgoingBallDirectionZ[i]);
+      radian ballDirectionAngle = fabs(outgoingBallDirection2D.GetNormalized(animBallDirection).GetAngle2D(animBallDirection));
+      if (ballDirectionAngle > table.outgoingBallMaxDeviation[i]) continue;
+    }
+
+    const VariableCache &variables = animations[i]->GetVariableCache();
+    if (query.properties.incoming_special_state().compare(variables.incoming_special_state()) != 0) continue;
+    // hax: allow switching of hands (except for deflect anims)
+    if ((query.functionType == e_FunctionType_Deflect || (queryRetainsBall != (variables.incoming_retain_state().compare("") != 0))) &&
+        query.properties.incoming_retain_state().compare(variables.incoming_retain_state()) != 0) continue;
+    if (query.properties.specialvar1() != variables.specialvar1()) continue;
+    if (query.properties.specialvar2() != variables.specialvar2()) continue;
+
+    if (query.byTripType == true) {
+      if (table.tripType[i] != query.tripType) continue;
+    }
+
+    if (query.heedForcedFoot == true) {
+      if (table.forcedFoot[i] == 1 && query.strongFoot != table.touchFoot[i]) continue;
+      if (table.forcedFoot[i] == 2 && query.strongFoot == table.touchFoot[i]) continue;
+    }
+
+    dataSet.push_back(i);
+  }
+}
+
 int AnimCollection::GetQuadrantID(Animation *animation, const Vector3 &movement, radian angle) const {
     // assign the animation it's rightful quadrant
 
@@ -960,12 +1349,14 @@ void AnimCollection::_PrepareAnim(Animation *animation, boost::intrusive_ptr<Nod
 
   // assign the animation its rightful quadrant
 
-  Vector3 movement = animation->GetOutgoingMovement();
+  Vector3 movement = animation->GetRangedOutgoingMovement();
   radian angle = animation->GetOutgoingAngle();
   int quadrantID = GetQuadrantID(animation, movement, angle);
 
   animation->SetVariable("quadrant_id", int_to_str(quadrantID));
 
+  // collection is shared between matches, which may run on different threads
+  animation->UpdateCache();
   animations.push_back(animation);
 }
 
@@ -151,6 +151,40 @@ struct Quadrant {
 
 void FillNodeMap(boost::intrusive_ptr<Node> targetNode, NodeMap &nodeMap);
 
+// Per animation data used by CrudeSelection, derived once after loading and
+// stored as structure of arrays (indexed by animation index), so that queries
+// don't have to recompute angles or look up animation variables by name.
+struct AnimSelectionTable {
+  void Clear();
+  void Add(const Animation *animation, radian maxIncomingBallDirectionDeviation, radian maxOutgoingBallDirectionDeviation);
+
+  std::vector<e_DefString> animType;
+  std::vector<e_Velocity> incomingVelocity;
+  std::vector<e_Velocity> outgoingVelocity;
+  // Ranged velocities with dribble treated as walk (for linearity checks).
+  std::vector<float> linearIncomingVelocity;
+  std::vector<float> linearOutgoingVelocity;
+  std::vector<float> incomingBodyDirectionX, incomingBodyDirectionY, incomingBodyDirectionZ;
+  // Outgoing direction rotated by the outgoing body angle.
+  std::vector<float> outgoingDirectionX, outgoingDirectionY, outgoingDirectionZ;
+  // Absolute outgoing body direction.
+  std::vector<float> outgoingBodyDirectionX, outgoingBodyDirectionY, outgoingBodyDirectionZ;
+  std::vector<radian> turnAngle;
+  std::vector<radian> incomingBodyAngleAbs;
+  std::vector<char> retainsBall;
+  std::vector<char> lastDitch;
+  std::vector<float> incomingBallDirectionLength;
+  // Normalized incoming ball direction with decimated height.
+  std::vector<float> incomingBallDirectionX, incomingBallDirectionY, incomingBallDirectionZ;
+  std::vector<radian> incomingBallMaxDeviation;
+  std::vector<float> outgoingBallDirectionX, outgoingBallDirectionY, outgoingBallDirectionZ;
+  std::vector<radian> outgoingBallMaxDeviation;
+  std::vector<int> tripType;
+  // 0: no forced foot, 1: strong foot, 2: weak foot.
+  std::vector<int> forcedFoot;
+  std::vector<e_Foot> touchFoot;
+};
+
 class AnimCollection {
 
   public:
@@ -159,11 +193,18 @@ class AnimCollection {
     virtual ~AnimCollection();
 
     void Clear();
-    void Load();
+    // Loads the prepared animations and their positions (on the pitch, per
+    // frame). Uses the binary animation cache when it is up to date
+    // with the animation sources, falls back to the sources otherwise.
+    void Load(std::map<Animation*, std::vector<Vector3>> &positionCache);
+    // Writes the loaded animations to a binary animation cache.
+    bool SaveCache(const std::string &filename, std::map<Animation*, std::vector<Vector3>> &positionCache);
 
     const std::vector < Animation* > &GetAnimations() const;
 
     void CrudeSelection(DataSet &dataSet, const CrudeSelectionQuery &query);
+    // Reference implementation of CrudeSelection, scanning all animations.
+    void CrudeSelectionLinear(DataSet &dataSet, const CrudeSelectionQuery &query);
 
     inline Animation* GetAnim(int index) {
       return animations.at(index);
@@ -177,15 +218,28 @@ class AnimCollection {
 
   protected:
 
+    void _GetSourceFiles(std::vector<std::string> &templateFiles, std::vector<std::string> &animFiles) const;
+    uint64_t _SourceChecksum() const;
+    void _LoadSources(std::map<Animation*, std::vector<Vector3>> &positionCache);
+    bool _LoadCache(const std::string &filename, std::map<Animation*, std::vector<Vector3>> &positionCache);
+    void _ProcessCache(AnimationCache *cache, uint64_t checksum, std::map<Animation*, std::vector<Vector3>> &positionCache);
+
     void _PrepareAnim(Animation *animation, boost::intrusive_ptr<Node> playerNode, const std::list < boost::intrusive_ptr<Object> > &bodyParts, const NodeMap &nodeMap, bool convertAngledDribbleToWalk = false);
 
     bool _CheckFunctionType(e_DefString functionType, e_FunctionType queryFunctionType) const;
+    void _BuildSelectionIndex();
 
     boost::shared_ptr<Scene3D> scene3D;
 
     std::vector<Animation*> animations;
     std::vector<Quadrant> quadrants;
 
+    AnimSelectionTable selectionTable;
+    // Sorted animation indices per incoming velocity, for all animations and
+    // per function type.
+    std::vector<int> allAnimsIndex[e_Velocity_Sprint + 1];
+    std::vector<int> functionTypeIndex[e_FunctionType_Special + 1][e_Velocity_Sprint + 1];
+
     radian maxIncomingBallDirectionDeviation;
     radian maxOutgoingBallDirectionDeviation;
 
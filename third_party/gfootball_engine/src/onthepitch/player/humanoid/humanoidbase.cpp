@@ -35,6 +35,21 @@ constexpr float bodyRotationSmoothingFactor = 1.0f;
 constexpr float bodyRotationSmoothingMaxAngle = 0.25f * pi;
 constexpr float initialReQueueDelayFrames = 32;
 
+// stable sort of anim indices by ascending rating. ratings live next to the
+// indices rather than on the animations, since those are shared between matches
+template <typename Rating>
+void StableSortByRating(DataSet &dataSet, Rating rating) {
+  std::vector<std::pair<float, int> > rated;
+  rated.reserve(dataSet.size());
+  for (auto& anim : dataSet) {
+    rated.push_back(std::pair<float, int>(rating(anim), anim));
+  }
+  std::stable_sort(rated.begin(), rated.end(), [](const std::pair<float, int> &a, const std::pair<float, int> &b) { return a.first < b.first; });
+  for (unsigned int i = 0; i < rated.size(); i++) {
+    dataSet[i] = rated[i].second;
+  }
+}
+
 void FillTemporalHumanoidNodes(boost::intrusive_ptr<Node> targetNode, std::vector<TemporalHumanoidNode> &temporalHumanoidNodes) {
   //printf("%s\n", targetNode->GetName().c_str());
   TemporalHumanoidNode temporalHumanoidNode;
@@ -118,33 +133,37 @@ HumanoidBase::HumanoidBase(PlayerBase *player, Match *match, boost::intrusive_pt
   humanoidNode = bla;
   humanoidNode->SetLocalMode(e_LocalMode_Absolute);
 
-  boost::intrusive_ptr < Resource<Surface> > skin;
-  skin = GetContext().surface_manager.Fetch(
-      "media/objects/players/textures/skin0" +
-          int_to_str(player->GetPlayerData()->GetSkinColor()) + ".png",
-      true, true);
-
-  boost::intrusive_ptr<Node> bla2(new Node(*fullbodySourceNode.get(), int_to_str(player->GetID()), GetScene3D()));
-  fullbodyNode = bla2;
-  fullbodyNode->SetLocalMode(e_LocalMode_Absolute);
-  fullbodyTargetNode->AddNode(fullbodyNode);
-
-  boost::intrusive_ptr< Resource<GeometryData> > bodyGeom = boost::static_pointer_cast<Geometry>(fullbodyNode->GetObject("fullbody"))->GetGeometryData();
-  std::vector < MaterializedTriangleMesh > &tmesh = bodyGeom->GetResource()->GetTriangleMeshesRef();
-  for (unsigned int i = 0; i < tmesh.size(); i++) {
-    if (tmesh[i].material.diffuseTexture != boost::intrusive_ptr< Resource<Surface> >()) {
-      if (tmesh[i].material.diffuseTexture->GetIdentString() == "skin.jpg") {
-        tmesh[i].material.diffuseTexture = skin;
-        tmesh[i].material.specular_amount = 0.002f;
-        tmesh[i].material.shininess = 0.2f;
+  // without a full body source node, the humanoid is simulated only (physics
+  // only mode) and gets no model, kit or hairstyle
+  if (fullbodySourceNode) {
+    boost::intrusive_ptr < Resource<Surface> > skin;
+    skin = GetContext().surface_manager.Fetch(
+        "media/objects/players/textures/skin0" +
+            int_to_str(player->GetPlayerData()->GetSkinColor()) + ".png",
+        true, true);
+
+    boost::intrusive_ptr<Node> bla2(new Node(*fullbodySourceNode.get(), int_to_str(player->GetID()), GetScene3D()));
+    fullbodyNode = bla2;
+    fullbodyNode->SetLocalMode(e_LocalMode_Absolute);
+    fullbodyTargetNode->AddNode(fullbodyNode);
+
+    boost::intrusive_ptr< Resource<GeometryData> > bodyGeom = boost::static_pointer_cast<Geometry>(fullbodyNode->GetObject("fullbody"))->GetGeometryData();
+    std::vector < MaterializedTriangleMesh > &tmesh = bodyGeom->GetResource()->GetTriangleMeshesRef();
+    for (unsigned int i = 0; i < tmesh.size(); i++) {
+      if (tmesh[i].material.diffuseTexture != boost::intrusive_ptr< Resource<Surface> >()) {
+        if (tmesh[i].material.diffuseTexture->GetIdentString() == "skin.jpg") {
+          tmesh[i].material.diffuseTexture = skin;
+          tmesh[i].material.specular_amount = 0.002f;
+          tmesh[i].material.shininess = 0.2f;
+        }
       }
     }
-  }
 
-  boost::static_pointer_cast<Geometry>(fullbodyNode->GetObject("fullbody"))->OnUpdateGeometryData();
+    boost::static_pointer_cast<Geometry>(fullbodyNode->GetObject("fullbody"))->OnUpdateGeometryData();
 
-  kitDiffuseTextureIdentString = "kit_template.png";
-  SetKit(kit);
+    kitDiffuseTextureIdentString = "kit_template.png";
+    SetKit(kit);
+  }
 
 
   scene3D = GetScene3D();
@@ -158,36 +177,38 @@ HumanoidBase::HumanoidBase(PlayerBase *player, Match *match, boost::intrusive_pt
 
   // hairstyle
 
-  boost::intrusive_ptr<Resource<GeometryData> > geometry =
-      GetContext().geometry_manager.Fetch(
-          "media/objects/players/hairstyles/" +
-              player->GetPlayerData()->GetHairStyle() + ".ase",
-          true, true);
-  hairStyle =
-      static_pointer_cast<Geometry>(GetContext().object_factory.CreateObject(
-          "hairstyle", e_ObjectType_Geometry));
-
-  scene3D->CreateSystemObjects(hairStyle);
-  hairStyle->SetLocalMode(e_LocalMode_Absolute);
-  hairStyle->SetGeometryData(geometry);
-  fullbodyTargetNode->AddObject(hairStyle);
-
-  boost::intrusive_ptr < Resource<Surface> > hairTexture;
-  hairTexture = GetContext().surface_manager.Fetch(
-      "media/objects/players/textures/hair/" +
-          player->GetPlayerData()->GetHairColor() + ".png",
-      true, true);
-
-  std::vector < MaterializedTriangleMesh > &hairtmesh = hairStyle->GetGeometryData()->GetResource()->GetTriangleMeshesRef();
-
-  for (unsigned int i = 0; i < hairtmesh.size(); i++) {
-    if (hairtmesh[i].material.diffuseTexture != boost::intrusive_ptr<Resource <Surface> >()) {
-      hairtmesh[i].material.diffuseTexture = hairTexture;
-      hairtmesh[i].material.specular_amount = 0.01f;
-      hairtmesh[i].material.shininess = 0.05f;
+  if (fullbodyNode) {
+    boost::intrusive_ptr<Resource<GeometryData> > geometry =
+        GetContext().geometry_manager.Fetch(
+            "media/objects/players/hairstyles/" +
+                player->GetPlayerData()->GetHairStyle() + ".ase",
+            true, true);
+    hairStyle =
+        static_pointer_cast<Geometry>(GetContext().object_factory.CreateObject(
+            "hairstyle", e_ObjectType_Geometry));
+
+    scene3D->CreateSystemObjects(hairStyle);
+    hairStyle->SetLocalMode(e_LocalMode_Absolute);
+    hairStyle->SetGeometryData(geometry);
+    fullbodyTargetNode->AddObject(hairStyle);
+
+    boost::intrusive_ptr < Resource<Surface> > hairTexture;
+    hairTexture = GetContext().surface_manager.Fetch(
+        "media/objects/players/textures/hair/" +
+            player->GetPlayerData()->GetHairColor() + ".png",
+        true, true);
+
+    std::vector < MaterializedTriangleMesh > &hairtmesh = hairStyle->GetGeometryData()->GetResource()->GetTriangleMeshesRef();
+
+    for (unsigned int i = 0; i < hairtmesh.size(); i++) {
+      if (hairtmesh[i].material.diffuseTexture != boost::intrusive_ptr<Resource <Surface> >()) {
+        hairtmesh[i].material.diffuseTexture = hairTexture;
+        hairtmesh[i].material.specular_amount = 0.01f;
+        hairtmesh[i].material.shininess = 0.05f;
+      }
     }
+    hairStyle->OnUpdateGeometryData();
   }
-  hairStyle->OnUpdateGeometryData();
 
 
   ResetPosition(Vector3(0), Vector3(0));
@@ -198,8 +219,10 @@ HumanoidBase::HumanoidBase(PlayerBase *player, Match *match, boost::intrusive_pt
 HumanoidBase::~HumanoidBase() {
   humanoidNode->Exit();
   humanoidNode.reset();
-  fullbodyTargetNode->DeleteNode(fullbodyNode);
-  fullbodyTargetNode->DeleteObject(hairStyle);
+  if (fullbodyNode) {
+    fullbodyTargetNode->DeleteNode(fullbodyNode);
+    fullbodyTargetNode->DeleteObject(hairStyle);
+  }
 
   buf_TemporalHumanoidNodes.clear();
 
@@ -243,6 +266,40 @@ void HumanoidBase::PrepareFullbodyModel(std::map<Vector3, Vector3> &colorCoords)
     joints.push_back(joint);
   }
 
+  if (fullbodyNode) {
+    PrepareFullbodyMesh(colorCoords);
+  }
+
+  for (unsigned int i = 0; i < joints.size(); i++) {
+    joints[i].orientation = jointsVec[i]->GetDerivedRotation().GetInverse().GetNormalized();
+  }
+
+  Animation *straightAnim = new Animation();
+  straightAnim->Load("media/animations/straight.anim.util");
+  animApplyBuffer.anim = straightAnim;
+  animApplyBuffer.anim->Apply(nodeMap, animApplyBuffer.frameNum, 0, animApplyBuffer.smooth, animApplyBuffer.smoothFactor, animApplyBuffer.position, animApplyBuffer.orientation, animApplyBuffer.offsets, 0, false, true);
+
+  for (unsigned int i = 0; i < joints.size(); i++) {
+    joints[i].position = jointsVec[i]->GetDerivedPosition();// * zMultiplier;
+  }
+
+  if (fullbodyNode) {
+    UpdateFullbodyModel(true);
+    boost::static_pointer_cast<Geometry>(fullbodyNode->GetObject("fullbody"))->OnUpdateGeometryData(false);
+  }
+
+  for (unsigned int i = 0; i < joints.size(); i++) {
+    joints[i].origPos = jointsVec[i]->GetDerivedPosition();
+  }
+
+  delete straightAnim;
+  delete baseAnim;
+
+  //printf("vertexcount: %i, unique vertexcount: %i\n", elementOffset / 3, uniqueElementOffset / 3);
+}
+
+void HumanoidBase::PrepareFullbodyMesh(std::map<Vector3, Vector3> &colorCoords) {
+
   boost::intrusive_ptr < Resource<GeometryData> > fullbodyGeometryData = boost::static_pointer_cast<Geometry>(fullbodyNode->GetObject("fullbody"))->GetGeometryData();
   std::vector < MaterializedTriangleMesh > &materializedTriangleMeshes = fullbodyGeometryData->GetResource()->GetTriangleMeshesRef();
 
@@ -382,31 +439,6 @@ void HumanoidBase::PrepareFullbodyModel(std::map<Vector3, Vector3> &colorCoords)
   } // subgeom
 
   boost::static_pointer_cast<Geometry>(fullbodyNode->GetObject("fullbody"))->OnUpdateGeometryData();
-
-  for (unsigned int i = 0; i < joints.size(); i++) {
-    joints[i].orientation = jointsVec[i]->GetDerivedRotation().GetInverse().GetNormalized();
-  }
-
-  Animation *straightAnim = new Animation();
-  straightAnim->Load("media/animations/straight.anim.util");
-  animApplyBuffer.anim = straightAnim;
-  animApplyBuffer.anim->Apply(nodeMap, animApplyBuffer.frameNum, 0, animApplyBuffer.smooth, animApplyBuffer.smoothFactor, animApplyBuffer.position, animApplyBuffer.orientation, animApplyBuffer.offsets, 0, false, true);
-
-  for (unsigned int i = 0; i < joints.size(); i++) {
-    joints[i].position = jointsVec[i]->GetDerivedPosition();// * zMultiplier;
-  }
-
-  UpdateFullbodyModel(true);
-  boost::static_pointer_cast<Geometry>(fullbodyNode->GetObject("fullbody"))->OnUpdateGeometryData(false);
-
-  for (unsigned int i = 0; i < joints.size(); i++) {
-    joints[i].origPos = jointsVec[i]->GetDerivedPosition();
-  }
-
-  delete straightAnim;
-  delete baseAnim;
-
-  //printf("vertexcount: %i, unique vertexcount: %i\n", elementOffset / 3, uniqueElementOffset / 3);
 }
 
 void HumanoidBase::UpdateFullbodyNodes() {
@@ -697,7 +729,7 @@ void HumanoidBase::PreparePutBuffers(unsigned long snapshotTime_ms) {
 
   // display humanoids farther away from action at half FPS
   buf_LowDetailMode = false;
-  if (!player->GetExternalController() && !match->GetPause()) {
+  if (fullbodyNode && !player->GetExternalController() && !match->GetPause()) {
     Vector3 focusPos = match->GetBall()->Predict(100).Get2D();
     if (match->GetDesignatedPossessionPlayer()) {
       focusPos = focusPos * 0.5f + match->GetDesignatedPossessionPlayer()->GetPosition() * 0.5f;
@@ -957,6 +989,126 @@ void HumanoidBase::SetKit(boost::intrusive_ptr < Resource<Surface> > newKit) {
   boost::static_pointer_cast<Geometry>(fullbodyNode->GetObject("fullbody"))->OnUpdateGeometryData();
 }
 
+void ProcessOffsetsState(EnvState *state, BiasedOffsets &offsets) {
+  for (int x = 0; x < body_part_max; x++) {
+    BiasedOffset &offset = offsets[static_cast<BodyPart>(x)];
+    state->Process(offset.orientation);
+    state->Process(offset.bias);
+    state->Process(offset.isRelative);
+  }
+}
+
+void ProcessAnimState(EnvState *state, Anim &anim) {
+  state->Process(anim.anim);
+  state->Process(anim.id);
+  state->Process(anim.frameNum);
+  state->Process(anim.functionType);
+  state->Process(anim.originatingInterrupt);
+  state->Process(anim.fullActionSmuggle);
+  state->Process(anim.actionSmuggle);
+  state->Process(anim.actionSmuggleOffset);
+  state->Process(anim.actionSmuggleSustain);
+  state->Process(anim.actionSmuggleSustainOffset);
+  state->Process(anim.movementSmuggle);
+  state->Process(anim.movementSmuggleOffset);
+  state->Process(anim.rotationSmuggle.begin);
+  state->Process(anim.rotationSmuggle.end);
+  state->Process(anim.rotationSmuggleOffset);
+  state->Process(anim.touchFrame);
+  state->Process(anim.radiusOffset);
+  state->Process(anim.touchPos);
+  state->Process(anim.incomingMovement);
+  state->Process(anim.outgoingMovement);
+  state->Process(anim.positionOffset);
+  state->Process(anim.originatingCommand);
+  state->Process(anim.positions);
+}
+
+void HumanoidBase::ProcessState(EnvState *state) {
+  ProcessAnimState(state, *currentAnim);
+  ProcessAnimState(state, *previousAnim);
+  state->Process(animApplyBuffer.anim);
+  state->Process(animApplyBuffer.frameNum);
+  state->Process(animApplyBuffer.snapshotTime_ms);
+  state->Process(animApplyBuffer.smooth);
+  state->Process(animApplyBuffer.smoothFactor);
+  state->Process(animApplyBuffer.noPos);
+  state->Process(animApplyBuffer.position);
+  state->Process(animApplyBuffer.orientation);
+  ProcessOffsetsState(state, animApplyBuffer.offsets);
+  state->Process(fetchedbuf_previousSnapshotTime_ms);
+  state->Process(buf_bodyUpdatePhase);
+  ProcessOffsetsState(state, offsets);
+  state->Process(startPos);
+  state->Process(startAngle);
+  state->Process(nextStartPos);
+  state->Process(nextStartAngle);
+  state->Process(spatialState.position);
+  state->Process(spatialState.angle);
+  state->Process(spatialState.directionVec);
+  state->Process(spatialState.enumVelocity);
+  state->Process(spatialState.floatVelocity);
+  state->Process(spatialState.actualMovement);
+  state->Process(spatialState.physicsMovement);
+  state->Process(spatialState.animMovement);
+  state->Process(spatialState.movement);
+  state->Process(spatialState.actionSmuggleMovement);
+  state->Process(spatialState.movementSmuggleMovement);
+  state->Process(spatialState.positionOffsetMovement);
+  state->Process(spatialState.bodyAngle);
+  state->Process(spatialState.bodyDirectionVec);
+  state->Process(spatialState.relBodyAngleNonquantized);
+  state->Process(spatialState.relBodyAngle);
+  state->Process(spatialState.relBodyDirectionVec);
+  state->Process(spatialState.relBodyDirectionVecNonquantized);
+  state->Process(spatialState.foot);
+  state->Process(previousPosition2D);
+  state->Process(interruptAnim);
+  state->Process(reQueueDelayFrames);
+  state->Process(tripType);
+  state->Process(tripDirection);
+  state->Process(decayingPositionOffset);
+  state->Process(decayingDifficultyFactor);
+  state->Process(currentMentalImage);
+
+  int historySize = movementHistory.size();
+  state->Process(historySize);
+  if (state->IsLoading()) {
+    if (state->Failed() || historySize < 0 || historySize > body_part_max) {
+      state->SetFailed();
+      return;
+    }
+    movementHistory.resize(historySize);
+  }
+  for (auto &entry : movementHistory) {
+    state->Process(entry.nodeName);
+    state->Process(entry.position);
+    state->Process(entry.orientation);
+    state->Process(entry.timeDiff_ms);
+  }
+
+  // node transforms are used for collision checks, so they are part of the
+  // simulation state as well
+  state->Verify(buf_TemporalHumanoidNodes.size());
+  for (auto &node : buf_TemporalHumanoidNodes) {
+    Vector3 position = node.actualNode->GetPosition();
+    Quaternion rotation = node.actualNode->GetRotation();
+    state->Process(position);
+    state->Process(rotation);
+    if (state->IsLoading()) {
+      node.actualNode->SetPosition(position, false);
+      node.actualNode->SetRotation(rotation, false);
+    }
+    state->Process(node.cachedPosition);
+    state->Process(node.cachedOrientation);
+    node.position.ProcessState(state);
+    node.orientation.ProcessState(state);
+  }
+  if (state->IsLoading()) {
+    humanoidNode->RecursiveUpdateSpatialData(e_SpatialDataType_Both);
+  }
+}
+
 void HumanoidBase::ResetSituation(const Vector3 &focusPos) {
   currentMentalImage = 0;
 
@@ -984,10 +1136,7 @@ void HumanoidBase::_KeepBestDirectionAnims(DataSet &dataSet, const PlayerCommand
   int bestQuadrantID = forcedQuadrantID;
   if (bestQuadrantID == -1) {
 
-    for (auto& anim : dataSet) {
-      anims->GetAnim(anim)->order_float = GetMovementSimilarity(anim, predicate_RelDesiredDirection, predicate_DesiredVelocity, predicate_CorneringBias);
-    }
-    std::stable_sort(dataSet.begin(), dataSet.end(), boost::bind(&HumanoidBase::CompareByOrderFloat, this, _1, _2));
+    StableSortByRating(dataSet, [this](int anim) { return GetMovementSimilarity(anim, predicate_RelDesiredDirection, predicate_DesiredVelocity, predicate_CorneringBias); });
 
     // we want the best anim to be a baseanim, and compare other anims to it
     if (strict) {
@@ -1042,10 +1191,7 @@ void HumanoidBase::_KeepBestBodyDirectionAnims(DataSet &dataSet, const PlayerCom
   // delete nonqualified bodydir quadrants
 
   assert(dataSet.size() != 0);
-  for (auto& anim : dataSet) {
-    anims->GetAnim(anim)->order_float = DirectionSimilarityRating(anim);
-  }
-  std::stable_sort(dataSet.begin(), dataSet.end(), boost::bind(&HumanoidBase::CompareByOrderFloat, this, _1, _2));
+  StableSortByRating(dataSet, [this](int anim) { return DirectionSimilarityRating(anim); });
 
   // we want the best anim to be a baseanim, and compare other anims to it
   if (strict) {
@@ -1522,12 +1668,6 @@ bool HumanoidBase::CompareMovementSimilarity(int animIndex1, int animIndex2) con
   return rating1 < rating2;
 }
 
-bool HumanoidBase::CompareByOrderFloat(int animIndex1, int animIndex2) const {
-  float rating1 = anims->GetAnim(animIndex1)->order_float;
-  float rating2 = anims->GetAnim(animIndex2)->order_float;
-  return rating1 < rating2;
-}
-
 void HumanoidBase::SetIncomingBodyDirectionSimilarityPredicate(const Vector3 &relIncomingBodyDirection) const {
   predicate_RelIncomingBodyDirection = relIncomingBodyDirection;
 }
@@ -193,6 +193,7 @@ class HumanoidBase {
     virtual ~HumanoidBase();
 
     void PrepareFullbodyModel(std::map<Vector3, Vector3> &colorCoords);
+    void PrepareFullbodyMesh(std::map<Vector3, Vector3> &colorCoords);
     void UpdateFullbodyNodes();
     bool NeedsModelUpdate();
     void UpdateFullbodyModel(bool updateSrc = false);
@@ -236,12 +237,14 @@ class HumanoidBase {
 
     const NodeMap &GetNodeMap() { return nodeMap; }
 
-    void Hide() { fullbodyNode->SetPosition(Vector3(1000, 1000, -1000)); hairStyle->SetPosition(Vector3(1000, 1000, -1000)); } // hax ;)
+    void Hide() { if (!fullbodyNode) return; fullbodyNode->SetPosition(Vector3(1000, 1000, -1000)); hairStyle->SetPosition(Vector3(1000, 1000, -1000)); } // hax ;)
 
     void SetKit(boost::intrusive_ptr < Resource<Surface> > newKit);
 
     virtual void ResetSituation(const Vector3 &focusPos);
 
+    void ProcessState(EnvState *state);
+
   protected:
     bool _HighOrBouncyBall() const;
     void _KeepBestDirectionAnims(DataSet& dataset, const PlayerCommand &command, bool strict = true, radian allowedAngle = 0, int allowedVelocitySteps = 0, int forcedQuadrantID = -1); // ALERT: set sorting predicates before calling this function. strict kinda overrules the allowedstuff
@@ -264,7 +267,6 @@ class HumanoidBase {
     void SetMovementSimilarityPredicate(const Vector3 &relDesiredDirection, e_Velocity desiredVelocity) const;
     float GetMovementSimilarity(int animIndex, const Vector3 &relDesiredDirection, e_Velocity desiredVelocity, float corneringBias) const;
     bool CompareMovementSimilarity(int animIndex1, int animIndex2) const;
-    bool CompareByOrderFloat(int animIndex1, int animIndex2) const;
     void SetIncomingBodyDirectionSimilarityPredicate(
         const Vector3 &relIncomingBodyDirection) const;
     bool CompareIncomingBodyDirectionSimilarity(int animIndex1, int animIndex2) const;
@@ -81,21 +81,10 @@ void Player::Activate(boost::intrusive_ptr<Node> humanoidSourceNode, boost::intr
 
   assert(!isActive);
 
-  isActive = true;
-
   humanoid = new Humanoid(this, humanoidSourceNode, fullbodySourceNode, colorCoords, animCollection, GetTeam()->GetSceneNode(), kit, GetTeam()->GetID());
+  this->lazyPlayer = lazyPlayer;
 
-  controller = new ElizaController(match, lazyPlayer);
-  CastController()->SetPlayer(this);
-  CastController()->LoadStrategies();
-
-  buf_nameCaptionShowCondition = false;
-
-  nameCaption = new Gui2Caption(GetMenuTask()->GetWindowManager(), "game_player_name_" + int_to_str(id), 0, 0, 1, 2.0, playerData->GetLastName());
-  nameCaption->SetTransparency(0.3f);
-  GetMenuTask()->GetWindowManager()->GetRoot()->AddView(nameCaption);
-  debugCaption = new Gui2Caption(GetMenuTask()->GetWindowManager(), "game_player_debug_" + int_to_str(id), 0, 0, 1, 1.6, "debug");
-  GetMenuTask()->GetWindowManager()->GetRoot()->AddView(debugCaption);
+  Reactivate();
 
   CastHumanoid()->ResetPosition(GetFormationEntry().position * 25 * Vector3(-team->GetSide(), -team->GetSide(), 0), Vector3(0));
 
@@ -118,6 +107,25 @@ void Player::Deactivate() {
   GetTeam()->UpdateDesignatedTeamPossessionPlayer();
 }
 
+void Player::Reactivate() {
+  assert(!isActive);
+
+  isActive = true;
+
+  // the humanoid survives Deactivate(), the rest is created anew
+  controller = new ElizaController(match, lazyPlayer);
+  CastController()->SetPlayer(this);
+  CastController()->LoadStrategies();
+
+  buf_nameCaptionShowCondition = false;
+
+  nameCaption = new Gui2Caption(GetMenuTask()->GetWindowManager(), "game_player_name_" + int_to_str(id), 0, 0, 1, 2.0, playerData->GetLastName());
+  nameCaption->SetTransparency(0.3f);
+  GetMenuTask()->GetWindowManager()->GetRoot()->AddView(nameCaption);
+  debugCaption = new Gui2Caption(GetMenuTask()->GetWindowManager(), "game_player_debug_" + int_to_str(id), 0, 0, 1, 1.6, "debug");
+  GetMenuTask()->GetWindowManager()->GetRoot()->AddView(debugCaption);
+}
+
 FormationEntry Player::GetFormationEntry() {
   return team->GetFormationEntry(id);
 }
@@ -160,18 +168,15 @@ void Player::UpdatePossessionStats(bool onInterval) {
 
   if (!onInterval) return;
 
-  timeNeededToGetToBall_previous_ms = timeNeededToGetToBall_ms;
-
-  // default
-  timeNeededToGetToBall_ms = std::max(
-      ballPredictionSize_ms,
-      (unsigned int)(std::round(
-          (match->GetBall()->Predict(ballPredictionSize_ms - 10).Get2D() -
-           (GetPosition() + GetMovement() * 0.2f))
-              .GetLength() /
-          (GetMaxVelocity() * 0.75f) * 1000)));
-  timeNeededToGetToBall_optimistic_ms = timeNeededToGetToBall_ms;
+  // scratch batch, reused so that its buffers don't get reallocated
+  static thread_local TimeToBallBatch batch;
+  batch.Clear();
+  AddToTimeToBallBatch(batch);
+  batch.Calculate(match->GetBall()->GetPredictions());
+  UpdatePossessionStats(batch.GetResult(0));
+}
 
+void Player::AddToTimeToBallBatch(TimeToBallBatch &batch) {
   unsigned int startTime_ms = 0;
   if ((CastHumanoid()->GetCurrentFunctionType() == e_FunctionType_ShortPass ||
        CastHumanoid()->GetCurrentFunctionType() == e_FunctionType_LongPass ||
@@ -179,54 +184,15 @@ void Player::UpdatePossessionStats(bool onInterval) {
        CastHumanoid()->GetCurrentFunctionType() == e_FunctionType_Shot) && !TouchPending()) {
     startTime_ms = 500;
   }
-
-  bool refine = false;
-  unsigned int timeStep_ms = 10;
-  unsigned int previous_ms = 0;
   bool precise = (team->GetDesignatedTeamPossessionPlayer() == this) ? true : false;
-  float previousDist = 0; // debug
-  for (unsigned int ms = startTime_ms; ms < ballPredictionSize_ms; ms += timeStep_ms) {
-    if (match->GetBall()->Predict(ms).coords[2] < 1.5f) {
-      TimeNeeded result = AI_GetTimeNeededForDistance_ms(GetPosition(), GetMovement(), match->GetBall()->Predict(ms).Get2D(), GetMaxVelocity(), precise, ms);
-      unsigned int timeNeeded = result.usual_ms;
-      unsigned int timeNeeded_optimistic = result.optimistic_ms;
-
-      if (timeNeeded_optimistic <= ms) {
-        if (ms < timeNeededToGetToBall_optimistic_ms) timeNeededToGetToBall_optimistic_ms = ms;
-      }
-
-      if (timeNeeded <= ms) {
-
-        // refinement round!
-        if (!refine) {
-
-          ms = previous_ms;
-          timeStep_ms = 10;
-          refine = true;
-          // found!
-        } else {
+  batch.AddPlayer(GetPosition(), GetMovement(), GetMaxVelocity(), startTime_ms, precise);
+}
 
-          timeNeededToGetToBall_ms = ms;
-          break;
+void Player::UpdatePossessionStats(const TimeNeeded &timeNeeded) {
 
-        }
-      }
-    }
-
-    // refine timestep (optimisation)
-    if (!refine) {
-      float balldist = (GetPosition() - match->GetBall()->Predict(ms).Get2D()).GetLength() + 0.2f; // add a little buffer
-      float maxBallVelo = 50;
-      // how long does it take for the ball at max velo to travel balldist?
-      unsigned int timeToGo_ms =
-          int(std::round((balldist / maxBallVelo) * 1000.0f));
-      timeStep_ms = clamp(timeToGo_ms, 10, 500);
-      // round to 10s
-      timeStep_ms = (timeStep_ms / 10) * 10;
-    } else timeStep_ms = 10;
-
-    previous_ms = ms;
-  }
+  timeNeededToGetToBall_previous_ms = timeNeededToGetToBall_ms;
+  timeNeededToGetToBall_ms = timeNeeded.usual_ms;
+  timeNeededToGetToBall_optimistic_ms = timeNeeded.optimistic_ms;
 
   if (TouchAnim() && TouchPending()) {
     unsigned int animTimeToBall_ms = (CastHumanoid()->GetTouchFrame() - GetCurrentFrame()) * 10;
@@ -456,6 +422,29 @@ float Player::GetStat(PlayerStat name) const {
   return playerData->GetStat(name) * multiplier;
 }
 
+void Player::ProcessState(EnvState *state) {
+  PlayerBase::ProcessState(state);
+  Player *manMarking = manMarkingID != -1 ? match->GetPlayer(manMarkingID) : 0;
+  state->Process(manMarking);
+  if (state->IsLoading()) manMarkingID = manMarking ? manMarking->GetID() : -1;
+  state->Process(dynamicFormationEntry);
+  state->Process(hasPossession);
+  state->Process(hasBestPossession);
+  state->Process(hasUniquePossession);
+  state->Process(possessionDuration_ms);
+  state->Process(timeNeededToGetToBall_ms);
+  state->Process(timeNeededToGetToBall_optimistic_ms);
+  state->Process(timeNeededToGetToBall_previous_ms);
+  state->Process(triggerControlledBallCollision);
+  state->Process(tacticalSituation.forwardSpaceRating);
+  state->Process(tacticalSituation.toGoalSpaceRating);
+  state->Process(tacticalSituation.spaceRating);
+  state->Process(tacticalSituation.forwardRating);
+  state->Process(desiredTimeToBall_ms);
+  state->Process(cards);
+  state->Process(cardEffectiveTime_ms);
+}
+
 void Player::ResetSituation(const Vector3 &focusPos) {
   PlayerBase::ResetSituation(focusPos);
 
@@ -21,6 +21,8 @@
 #include "humanoid/humanoid.hpp"
 #include "playerbase.hpp"
 
+#include "../AIsupport/timetoball.hpp"
+
 #include "../../utils/gui2/widgets/caption.hpp"
 
 #include "../../menu/menutask.hpp"
@@ -52,6 +54,7 @@ class Player : public PlayerBase {
     virtual void Activate(boost::intrusive_ptr<Node> humanoidSourceNode, boost::intrusive_ptr<Node> fullbodySourceNode, std::map<Vector3, Vector3> &colorCoords, boost::intrusive_ptr < Resource<Surface> > kit, boost::shared_ptr<AnimCollection> animCollection, bool lazyPlayer);
     // go back to bench/take a shower
     virtual void Deactivate();
+    virtual void Reactivate();
 
     bool TouchPending() { return CastHumanoid()->TouchPending(); }
     bool TouchAnim() { return CastHumanoid()->TouchAnim(); }
@@ -86,6 +89,10 @@ class Player : public PlayerBase {
     float GetAverageVelocity(float timePeriod_sec); // is reset on ResetSituation() calls
 
     void UpdatePossessionStats(bool onInterval = true);
+    // Batched version: adds the time to ball calculation of this player to
+    // 'batch', and then updates the stats using its result.
+    void AddToTimeToBallBatch(TimeToBallBatch &batch);
+    void UpdatePossessionStats(const TimeNeeded &timeNeeded);
 
     float GetClosestOpponentDistance() const;
 
@@ -114,10 +121,13 @@ class Player : public PlayerBase {
 
     virtual void ResetSituation(const Vector3 &focusPos);
 
+    virtual void ProcessState(EnvState *state);
+
   protected:
     void _CalculateTacticalSituation();
 
     Team *team = nullptr;
+    bool lazyPlayer = false;
 
     signed int manMarkingID = 0;
 
@@ -118,6 +118,25 @@ float PlayerBase::GetLastTouchBias(int decay_ms, unsigned long time_ms) {
   return 0.0f;
 }
 
+void PlayerBase::ProcessState(EnvState *state) {
+  bool active = isActive;
+  state->Process(active);
+  if (state->IsLoading() && active != isActive) {
+    if (active) {
+      Reactivate();
+    } else {
+      Deactivate();
+    }
+  }
+  if (!isActive) return;
+  state->Process(lastTouchTime_ms);
+  state->Process(lastTouchType);
+  state->Process(fatigueFactorInv);
+  state->Process(positionHistoryPerSecond);
+  humanoid->ProcessState(state);
+  controller->ProcessState(state);
+}
+
 void PlayerBase::ResetSituation(const Vector3 &focusPos) {
   positionHistoryPerSecond.clear();
   lastTouchTime_ms = 0;
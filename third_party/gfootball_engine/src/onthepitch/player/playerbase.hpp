@@ -43,6 +43,8 @@ class PlayerBase {
     virtual void Activate(boost::intrusive_ptr<Node> humanoidSourceNode, boost::intrusive_ptr<Node> fullbodySourceNode, std::map<Vector3, Vector3> &colorCoords, boost::intrusive_ptr < Resource<Surface> > kit, boost::shared_ptr<AnimCollection> animCollection, bool lazyPlayer) = 0;
     // go back to bench/take a shower
     virtual void Deactivate();
+    // back from the shower (undoes Deactivate, used when restoring a state)
+    virtual void Reactivate() = 0;
 
     void ResetPosition(const Vector3 &newPos, const Vector3 &focusPos) { humanoid->ResetPosition(newPos, focusPos); }
     void OffsetPosition(const Vector3 &offset) { humanoid->OffsetPosition(offset); }
@@ -105,6 +107,8 @@ class PlayerBase {
 
     virtual void ResetSituation(const Vector3 &focusPos);
 
+    virtual void ProcessState(EnvState *state);
+
   protected:
     Match *match;
 
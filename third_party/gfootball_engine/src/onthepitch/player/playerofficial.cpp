@@ -46,6 +46,13 @@ void PlayerOfficial::Activate(boost::intrusive_ptr<Node> humanoidSourceNode, boo
   CastController()->SetPlayer(this);
 }
 
+void PlayerOfficial::Reactivate() {
+  assert(!isActive);
+  isActive = true;
+  controller = new RefereeController(match);
+  CastController()->SetPlayer(this);
+}
+
 void PlayerOfficial::Deactivate() {
   PlayerBase::Deactivate();
 }
@@ -42,6 +42,7 @@ class PlayerOfficial : public PlayerBase {
 
     virtual void Activate(boost::intrusive_ptr<Node> humanoidSourceNode, boost::intrusive_ptr<Node> fullbodySourceNode, std::map<Vector3, Vector3> &colorCoords, boost::intrusive_ptr < Resource<Surface> > kit, boost::shared_ptr<AnimCollection> animCollection, bool lazyPlayer);
     virtual void Deactivate();
+    virtual void Reactivate();
 
     virtual void Process();
     virtual void PreparePutBuffers(unsigned long snapshotTime_ms);
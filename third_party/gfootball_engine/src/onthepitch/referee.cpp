@@ -195,6 +195,28 @@ void Referee::Process() {
   if (afterSetPieceRelaxTime_ms > 0) afterSetPieceRelaxTime_ms -= 10;
 }
 
+void Referee::ProcessState(EnvState *state) {
+  state->Process(buffer.active);
+  state->Process(buffer.desiredSetPiece);
+  state->Process(buffer.teamID);
+  state->Process(buffer.setpiece_teamID);
+  state->Process(buffer.stopTime);
+  state->Process(buffer.prepareTime);
+  state->Process(buffer.startTime);
+  state->Process(buffer.restartPos);
+  state->Process(buffer.taker);
+  state->Process(buffer.endPhase);
+  state->Process(afterSetPieceRelaxTime_ms);
+  state->Process(offsidePlayers);
+  state->Process(foul.foulPlayer);
+  state->Process(foul.foulVictim);
+  state->Process(foul.foulType);
+  state->Process(foul.advantage);
+  state->Process(foul.foulTime);
+  state->Process(foul.foulPosition);
+  state->Process(foul.hasBeenProcessed);
+}
+
 void Referee::PrepareSetPiece(e_GameMode setPiece) {
   // position players for set piece situation
 
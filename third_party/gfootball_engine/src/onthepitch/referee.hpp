@@ -74,6 +74,8 @@ class Referee {
     Player *GetCurrentFoulPlayer() { return foul.foulPlayer; }
     int GetCurrentFoulType() { return foul.foulType; }
 
+    void ProcessState(EnvState *state);
+
   protected:
     Match *match;
 
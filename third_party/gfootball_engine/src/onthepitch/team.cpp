@@ -89,20 +89,23 @@ void Team::InitPlayers(boost::intrusive_ptr<Node> fullbodyNode,
 
     if (i < playerNum) {
       // activate playerCount players (the starting eleven, usually)
-      std::string kitFilename;
       // printf("%i player id\n", player->GetID());
       auto formation = GetFormationEntry(player->GetID());
-      if (formation.role != e_PlayerRole_GK) {
-        kitFilename = GetTeamData()->GetKitUrl() + "_kit_0" +
-                      int_to_str(GetMenuTask()->GetTeamKitNum(GetID())) +
-                      ".png";
-        if (!boost::filesystem::exists(kitFilename))
-          kitFilename = (GetID() == 0) ? "media/textures/almost_white.png"
-                                       : "media/textures/almost_black.png";
-      } else {
-        kitFilename = "media/objects/players/textures/goalie_kit.png";
+      // kits are only needed by the full body models
+      if (fullbodyNode) {
+        std::string kitFilename;
+        if (formation.role != e_PlayerRole_GK) {
+          kitFilename = GetTeamData()->GetKitUrl() + "_kit_0" +
+                        int_to_str(GetMenuTask()->GetTeamKitNum(GetID())) +
+                        ".png";
+          if (!boost::filesystem::exists(kitFilename))
+            kitFilename = (GetID() == 0) ? "media/textures/almost_white.png"
+                                         : "media/textures/almost_black.png";
+        } else {
+          kitFilename = "media/objects/players/textures/goalie_kit.png";
+        }
+        kit = GetContext().surface_manager.Fetch(kitFilename);
       }
-      kit = GetContext().surface_manager.Fetch(kitFilename);
       player->Activate(
           playerNode, playerData->GetModelId() ? fullbody2Node : fullbodyNode,
           colorCoords, kit, match->GetAnimCollection(), formation.lazy);
@@ -299,6 +302,38 @@ void Team::ResetSituation(const Vector3 &focusPos) {
   GetController()->Reset();
 }
 
+void Team::ProcessState(EnvState *state) {
+  for (auto player : players) {
+    player->ProcessState(state);
+  }
+  for (unsigned int i = 0; i < players.size(); i++) {
+    FormationEntry entry = teamData->GetFormationEntry(i);
+    state->Process(entry);
+    if (state->IsLoading()) teamData->SetFormationEntry(i, entry);
+  }
+  state->Process(hasPossession);
+  state->Process(timeNeededToGetToBall_ms);
+  state->Process(designatedTeamPossessionPlayer);
+  state->Process(teamPossessionAmount);
+  state->Process(fadingTeamPossessionAmount);
+  teamController->ProcessState(state);
+  state->Verify(humanGamers.size());
+  if (state->IsLoading()) {
+    // release all players first, so no gamer takes over a player that
+    // another gamer has yet to release
+    for (auto humanGamer : humanGamers) {
+      humanGamer->SetSelectedPlayerID(-1);
+    }
+  }
+  for (auto humanGamer : humanGamers) {
+    humanGamer->ProcessState(state);
+  }
+  state->Process(switchPriority);
+  state->Process(lastTouchPlayers);
+  state->Process(lastTouchPlayer);
+  state->Process(lastTouchType);
+}
+
 void Team::HumanGamersSelectAnyone() {
   // make sure all human gamers have a player selected
 
@@ -351,6 +386,7 @@ void Team::RelaxFatigue(float howMuch) {
 }
 
 void Team::Process() {
+  ProfileScope profileScope(e_ProfileSection_Team);
   if (!match->GetPause()) {
     teamPossessionAmount = (float)(match->GetTeam(abs(GetID() - 1))
                                        ->GetTimeNeededToGetToBall_ms() +
@@ -538,9 +574,26 @@ void Team::Hide2D() {
 }
 
 void Team::UpdatePossessionStats() {
+  timeToBall.Clear();
+  for (unsigned int i = 0; i < players.size(); i++) {
+    if (players[i]->IsActive()) {
+      players[i]->AddToTimeToBallBatch(timeToBall);
+    }
+  }
+  const Vector3 *ballPredictions = match->GetBall()->GetPredictions();
+  timeToBall.Calculate(ballPredictions);
+#ifdef BENCHMARK_HOOKS
+  if (GetContext().timeToBallLog) {
+    GetContext().timeToBallLog->push_back(TimeToBallQuery());
+    TimeToBallQuery &query = GetContext().timeToBallLog->back();
+    query.batch = timeToBall;
+    query.ballPredictions.assign(ballPredictions, ballPredictions + ballPredictionSize_ms / 10);
+  }
+#endif
+  int index = 0;
   for (unsigned int i = 0; i < players.size(); i++) {
     if (players[i]->IsActive()) {
-      players[i]->UpdatePossessionStats();
+      players[i]->UpdatePossessionStats(timeToBall.GetResult(index++));
     }
   }
 
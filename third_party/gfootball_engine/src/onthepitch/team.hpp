@@ -101,6 +101,8 @@ class Team {
 
     Player *GetGoalie();
 
+    void ProcessState(EnvState *state);
+
   protected:
     int id = 0;
     Match *match;
@@ -108,6 +110,8 @@ class Team {
 
     bool hasPossession = false;
     int timeNeededToGetToBall_ms = 0;
+    // Scratch space of UpdatePossessionStats, kept to reuse its buffers.
+    TimeToBallBatch timeToBall;
     Player *designatedTeamPossessionPlayer;
 
     float teamPossessionAmount = 0.0f;
@@ -95,6 +95,7 @@ Player *SelectAttackingRunPlayer(Team *team) {
 }
 
 void TeamAIController::Process() {
+  ProfileScope profileScope(e_ProfileSection_TeamAIController);
 
   if (match->GetActualTime_ms() % 1000 == 0) UpdateTactics();
 
@@ -1016,6 +1017,61 @@ void TeamAIController::UpdateTactics() {
 
 }
 
+void TeamAIController::ProcessState(EnvState *state) {
+  state->Process(taker);
+  state->Process(setPieceType);
+  int tacticsCount = liveTeamTactics.GetProperties()->size();
+  state->Process(tacticsCount);
+  if (state->IsLoading()) {
+    for (int x = 0; x < tacticsCount && !state->Failed(); x++) {
+      std::string name;
+      std::string value;
+      state->Process(name);
+      state->Process(value);
+      liveTeamTactics.Set(name, value);
+    }
+  } else {
+    for (auto &tactic : *liveTeamTactics.GetProperties()) {
+      std::string name = tactic.first;
+      std::string value = tactic.second;
+      state->Process(name);
+      state->Process(value);
+    }
+  }
+  state->Process(offensivenessBias);
+  state->Process(teamHasPossession);
+  state->Process(teamHasUniquePossession);
+  state->Process(oppTeamHasPossession);
+  state->Process(oppTeamHasUniquePossession);
+  state->Process(teamHasBestPossession);
+  state->Process(teamPossessionAmount);
+  state->Process(fadingTeamPossessionAmount);
+  state->Process(timeNeededToGetToBall);
+  state->Process(oppTimeNeededToGetToBall);
+  state->Process(depth);
+  state->Process(width);
+  state->Process(offsideTrapX);
+  state->Process(endApplyAttackingRun_ms);
+  state->Process(attackingRunPlayer);
+  state->Process(endApplyTeamPressure_ms);
+  state->Process(teamPressurePlayer);
+  state->Process(endApplyKeeperRush_ms);
+  state->Process(forwardSupportPlayer);
+  int opponentCount = tacticalOpponentInfo.size();
+  state->Process(opponentCount);
+  if (state->IsLoading()) {
+    if (state->Failed() || opponentCount < 0 || opponentCount > 2 * playerNum) {
+      state->SetFailed();
+      return;
+    }
+    tacticalOpponentInfo.resize(opponentCount);
+  }
+  for (auto &info : tacticalOpponentInfo) {
+    state->Process(info.player);
+    state->Process(info.dangerFactor);
+  }
+}
+
 void TeamAIController::Reset() {
   taker = 0;
 
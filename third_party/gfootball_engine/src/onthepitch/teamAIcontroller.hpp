@@ -69,6 +69,8 @@ class TeamAIController {
 
     void Reset();
 
+    void ProcessState(EnvState *state);
+
   protected:
 
     Match *match;
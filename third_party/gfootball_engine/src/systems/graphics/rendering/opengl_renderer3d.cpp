@@ -64,9 +64,16 @@ OpenGLRenderer3D::OpenGLRenderer3D() : context(0) {
   };
 
   void OpenGLRenderer3D::SwapBuffers() {
-    last_screen_.resize(1280*720*3);
     SDL_GL_SwapWindow(window);
-    mapping.glReadPixels(0, 0, 1280, 720, GL_RGB, GL_UNSIGNED_BYTE, &last_screen_[0]);
+    // Readback goes into one pixel buffer object while GetScreen maps the
+    // other one, which holds the previous frame. So mapping doesn't wait for
+    // the readback just issued, at the cost of the screen lagging one frame.
+    readbackIndex = 1 - readbackIndex;
+    mapping.glBindBuffer(GL_PIXEL_PACK_BUFFER, readbackBuffers[readbackIndex]);
+    mapping.glReadPixels(0, 0, context_width, context_height, GL_RGB, GL_UNSIGNED_BYTE, 0);
+    mapping.glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    if (readbackFrames < 2) readbackFrames++;
+    readbackPending = true;
   }
 
   void OpenGLRenderer3D::LoadMatrix(const Matrix4 &mat) {
@@ -94,7 +101,7 @@ OpenGLRenderer3D::OpenGLRenderer3D() : context(0) {
     mapping.glMatrixMode(GL_PROJECTION);
     mapping.glPushMatrix();
     mapping.glLoadIdentity();
-    mapping.glOrtho(0, 1280, 720, 0, 0.1, 10);
+    mapping.glOrtho(0, context_width, context_height, 0, 0.1, 10);
 
     mapping.glMatrixMode(GL_MODELVIEW);
     mapping.glPushMatrix();
@@ -468,11 +475,21 @@ OpenGLRenderer3D::OpenGLRenderer3D() : context(0) {
 
     mapping.glDisable(GL_MULTISAMPLE);
 
+    last_screen_.resize(width * height * 3);
+    mapping.glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    mapping.glGenBuffers(2, readbackBuffers);
+    for (int i = 0; i < 2; i++) {
+      mapping.glBindBuffer(GL_PIXEL_PACK_BUFFER, readbackBuffers[i]);
+      mapping.glBufferData(GL_PIXEL_PACK_BUFFER, width * height * 3, 0, GL_STREAM_READ);
+    }
+    mapping.glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
     return true;
   }
 
   void OpenGLRenderer3D::Exit() {
     DeleteTexture(noiseTexID);
+    mapping.glDeleteBuffers(2, readbackBuffers);
 
     std::map<std::string, Shader>::iterator shaderIter = shaders.begin();
     while (shaderIter != shaders.end()) {
@@ -2118,6 +2135,26 @@ OpenGLRenderer3D::OpenGLRenderer3D() : context(0) {
   }
 
   const screenshoot& OpenGLRenderer3D::GetScreen() {
+    if (readbackPending) {
+      readbackPending = false;
+      const int rowSize = context_width * 3;
+      last_screen_.resize(rowSize * context_height);
+      // the previous frame, or the only one right after the start
+      int index = readbackFrames > 1 ? 1 - readbackIndex : readbackIndex;
+      mapping.glBindBuffer(GL_PIXEL_PACK_BUFFER, readbackBuffers[index]);
+      const char *pixels = static_cast<const char*>(mapping.glMapBufferRange(
+          GL_PIXEL_PACK_BUFFER, 0, last_screen_.size(), GL_MAP_READ_BIT));
+      if (pixels) {
+        // OpenGL returns rows bottom-up, flip them.
+        for (int y = 0; y < context_height; y++) {
+          memcpy(&last_screen_[y * rowSize], pixels + (context_height - 1 - y) * rowSize, rowSize);
+        }
+        mapping.glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+      } else {
+        Log(e_Error, "OpenGLRenderer3D", "GetScreen", "Could not map readback buffer");
+      }
+      mapping.glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
     return last_screen_;
   }
 
@@ -153,6 +153,12 @@ namespace blunted {
 
       signed int _cache_activeTextureUnit = 0;
       screenshoot last_screen_;
+      // Pixel buffers for asynchronous readback of the rendered frames, used
+      // alternately: GetScreen maps the one not written by the last readback.
+      unsigned int readbackBuffers[2] = { 0, 0 };
+      int readbackIndex = 0;
+      int readbackFrames = 0;
+      bool readbackPending = false;
 
   };
 }
@@ -203,6 +203,23 @@ template <> Quaternion TemporalSmoother<Quaternion>::DataMix(const Quaternion &d
   return data1.GetLerped(bias, data2);
 }
 
+template <typename T> void TemporalSmoother<T>::ProcessState(EnvState *state) {
+  int size = values.size();
+  state->Process(size);
+  if (state->IsLoading()) {
+    if (size < 0 || size > (int)values.capacity()) {
+      state->SetFailed();
+      return;
+    }
+    values.resize(size);
+  }
+  for (auto &value : values) {
+    state->Process(value.data);
+    state->Process(value.time_ms);
+  }
+  state->Process(snapshotSize);
+}
+
 template class TemporalSmoother<Vector3>;
 template class TemporalSmoother<Quaternion>;
 template class TemporalSmoother<float>;
@@ -116,6 +116,7 @@ template <typename T> class TemporalSmoother {
 
     void SetValue(const T &data, unsigned long valueTime_ms);
     T GetValue(unsigned long currentTime_ms, unsigned long history_ms = temporalSmoother_history_ms) const; // get interpolated measurement, history_ms seconds ago from now
+    void ProcessState(EnvState *state);
 
   protected:
     T DataMix(const T &data1, const T &data2, float bias = 0.0f) const;
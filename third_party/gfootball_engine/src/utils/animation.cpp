@@ -18,11 +18,13 @@
 #include "animation.hpp"
 
 #include "../base/utils.hpp"
+#include "../gamedefines.hpp"
 
 #include <stdio.h>
 
 #include <cmath>
 
+#include "animationcache.hpp"
 #include "animationextensions/footballanimationextension.hpp"
 
 namespace blunted {
@@ -110,6 +112,22 @@ namespace blunted {
     cache_outgoingBodyDirection_dirty = true;
   }
 
+  void Animation::UpdateCache() const {
+    // order matters: directions depend on the angles, angles on velocities
+    GetTranslation();
+    GetIncomingMovement();
+    GetIncomingVelocity();
+    GetOutgoingMovement();
+    GetRangedOutgoingMovement();
+    GetOutgoingVelocity();
+    GetOutgoingAngle();
+    GetOutgoingDirection();
+    GetIncomingBodyAngle();
+    GetIncomingBodyDirection();
+    GetOutgoingBodyAngle();
+    GetOutgoingBodyDirection();
+  }
+
   int Animation::GetFrameCount() const {
     return frameCount;
   }
@@ -733,6 +751,20 @@ namespace blunted {
     return cache_outgoingMovement;
   }
 
+  Vector3 Animation::GetRangedOutgoingMovement() const {
+    if (cache_rangedOutgoingMovement_dirty || cache_outgoingMovement_dirty) {
+      Vector3 movement = GetOutgoingMovement();
+      float velocity = movement.GetLength();
+      float rangedVelocity = idleVelocity;
+      if (velocity >= idleDribbleSwitch && velocity < dribbleWalkSwitch) rangedVelocity = dribbleVelocity;
+      else if (velocity >= dribbleWalkSwitch && velocity < walkSprintSwitch) rangedVelocity = walkVelocity;
+      else if (velocity >= walkSprintSwitch) rangedVelocity = sprintVelocity;
+      cache_rangedOutgoingMovement = movement.GetNormalized(0) * rangedVelocity;
+      cache_rangedOutgoingMovement_dirty = false;
+    }
+    return cache_rangedOutgoingMovement;
+  }
+
   Vector3 Animation::GetOutgoingDirection() const {
     if (cache_outgoingDirection_dirty || cache_angle_dirty) {
       cache_outgoingDirection = Vector3(0, -1, 0).GetRotated2D(GetOutgoingAngle());
@@ -1158,4 +1190,114 @@ namespace blunted {
     // flat list for speed, i guess, i should start documenting stuff earlier
     variableCache.set(name, value);
   }
+
+  void VariableCache::ProcessCache(AnimationCache *cache) {
+    int count = values.size();
+    if (!cache->ProcessSize(count)) return;
+    if (cache->IsLoading()) {
+      values.clear();
+      for (int i = 0; i < count && !cache->Failed(); i++) {
+        std::string key;
+        cache->Process(key);
+        cache->Process(values[key]);
+      }
+    } else {
+      for (auto &value : values) {
+        std::string key = value.first;
+        cache->Process(key);
+        cache->Process(value.second);
+      }
+    }
+    // derived values are stored too, mirror() only updates some of them
+    cache->Process(_idlelevel);
+    cache->Process(_quadrant_id);
+    cache->Process(_specialvar1);
+    cache->Process(_specialvar2);
+    cache->Process(_lastditch);
+    cache->Process(_baseanim);
+    cache->Process(_outgoing_special_state);
+    cache->Process(_incoming_retain_state);
+    cache->Process(_incoming_special_state);
+  }
+
+  void Animation::ProcessCache(AnimationCache *cache) {
+    int nodeCount = nodeAnimations.size();
+    if (!cache->ProcessSize(nodeCount)) return;
+    if (cache->IsLoading()) {
+      for (auto nodeAnimation : nodeAnimations) {
+        delete nodeAnimation;
+      }
+      nodeAnimations.clear();
+      for (int i = 0; i < nodeCount; i++) {
+        nodeAnimations.push_back(new NodeAnimation());
+      }
+      // variables live in the variable cache, custom data is only kept in
+      // sync by SetVariable
+      customData.reset(new XMLTree());
+    }
+    for (auto nodeAnimation : nodeAnimations) {
+      cache->Process(nodeAnimation->nodeName);
+      if (nodeAnimation->nodeName < 0 || nodeAnimation->nodeName >= body_part_max) {
+        cache->SetFailed();
+        return;
+      }
+      int keyCount = nodeAnimation->animation.d.size();
+      if (!cache->ProcessSize(keyCount)) return;
+      nodeAnimation->animation.d.resize(keyCount);
+      for (auto &keyFrame : nodeAnimation->animation.d) {
+        cache->Process(keyFrame.first);
+        cache->Process(keyFrame.second.orientation);
+        cache->Process(keyFrame.second.position);
+      }
+    }
+    cache->Process(frameCount);
+    cache->Process(name);
+
+    int extensionCount = extensions.size();
+    cache->Process(extensionCount);
+    if (extensionCount != (int)extensions.size()) {
+      cache->SetFailed();
+      return;
+    }
+    for (auto &extension : extensions) {
+      std::string extensionName = extension.first;
+      cache->Process(extensionName);
+      if (extensionName != extension.first) {
+        cache->SetFailed();
+        return;
+      }
+      extension.second->ProcessCache(cache);
+    }
+
+    variableCache.ProcessCache(cache);
+    cache->Process(currentFoot);
+
+    cache->Process(cache_translation_dirty);
+    cache->Process(cache_translation);
+    cache->Process(cache_incomingMovement_dirty);
+    cache->Process(cache_incomingMovement);
+    cache->Process(cache_incomingVelocity_dirty);
+    cache->Process(cache_incomingVelocity);
+    cache->Process(cache_outgoingDirection_dirty);
+    cache->Process(cache_outgoingDirection);
+    cache->Process(cache_outgoingMovement_dirty);
+    cache->Process(cache_outgoingMovement);
+    cache->Process(cache_rangedOutgoingMovement_dirty);
+    cache->Process(cache_rangedOutgoingMovement);
+    cache->Process(cache_outgoingVelocity_dirty);
+    cache->Process(cache_outgoingVelocity);
+    cache->Process(cache_angle_dirty);
+    cache->Process(cache_angle);
+    cache->Process(cache_incomingBodyAngle_dirty);
+    cache->Process(cache_incomingBodyAngle);
+    cache->Process(cache_outgoingBodyAngle_dirty);
+    cache->Process(cache_outgoingBodyAngle);
+    cache->Process(cache_incomingBodyDirection_dirty);
+    cache->Process(cache_incomingBodyDirection);
+    cache->Process(cache_outgoingBodyDirection_dirty);
+    cache->Process(cache_outgoingBodyDirection);
+
+    cache->Process(cache_AnimType);
+    cache->Process(cache_AnimType_str);
+  }
 }
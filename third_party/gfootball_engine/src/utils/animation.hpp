@@ -29,6 +29,8 @@
 
 namespace blunted {
 
+class AnimationCache;
+
 enum e_DefString {
   e_DefString_Empty = 0,
   e_DefString_OutgoingSpecialState = 1,
@@ -262,6 +264,8 @@ enum e_DefString {
       }
     }
 
+    void ProcessCache(AnimationCache *cache);
+
     void set_specialvar1(float v) {
       _specialvar1 = v;
     }
@@ -318,6 +322,9 @@ enum e_DefString {
       virtual ~Animation();
 
       void DirtyCache(); // hee hee
+      // computes all lazily cached values, so that afterwards the animation
+      // can be safely read from multiple threads at once
+      void UpdateCache() const;
 
       int GetFrameCount() const;
       int GetEffectiveFrameCount() const { return GetFrameCount() - 1; }
@@ -345,6 +352,8 @@ enum e_DefString {
       Vector3 GetIncomingMovement() const;
       float GetIncomingVelocity() const;
       Vector3 GetOutgoingMovement() const;
+      // outgoing movement with its velocity quantized to idle/dribble/walk/sprint
+      Vector3 GetRangedOutgoingMovement() const;
       Vector3 GetOutgoingDirection() const;
       Vector3 GetIncomingBodyDirection() const;
       Vector3 GetOutgoingBodyDirection() const;
@@ -376,7 +385,10 @@ enum e_DefString {
       std::vector<NodeAnimation *> &GetNodeAnimations() {
         return nodeAnimations;
       }
-      mutable float order_float = 0;
+
+      // Saves or loads the prepared animation, including its extensions and
+      // cached values. Extensions have to be added before loading.
+      void ProcessCache(AnimationCache *cache);
 
     protected:
       std::vector<NodeAnimation*> nodeAnimations;
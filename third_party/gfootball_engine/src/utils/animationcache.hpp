@@ -0,0 +1,43 @@
+// Copyright 2019 Google LLC & Bastiaan Konings
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _HPP_ANIMATIONCACHE
+#define _HPP_ANIMATIONCACHE
+
+#include "../defines.hpp"
+
+#include "../base/binarystream.hpp"
+
+namespace blunted {
+
+  // Binary stream of the animation cache (the prepared animations). Like
+  // EnvState, writing and reading share the same Process() calls.
+  class AnimationCache : public BinaryStream<AnimationCache> {
+
+    public:
+      // Starts writing a new cache.
+      AnimationCache() {}
+      // Starts reading the cache from 'data', which has to stay valid while
+      // reading.
+      AnimationCache(const char *data, size_t size)
+          : BinaryStream(data, size) {}
+
+      using BinaryStream::Process;
+      // Saves the value, or checks that it is equal to the saved one.
+      void Verify(uint64_t value);
+
+  };
+
+}
+
+#endif
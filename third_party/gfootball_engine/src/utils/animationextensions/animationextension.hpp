@@ -23,6 +23,7 @@
 namespace blunted {
 
   class Animation;
+  class AnimationCache;
 
   class AnimationExtension {
 
@@ -40,6 +41,7 @@ namespace blunted {
 
       virtual void Load(std::vector<std::string> &tokenizedLine) = 0;
       virtual void Save(FILE *file) = 0;
+      virtual void ProcessCache(AnimationCache *cache) = 0;
 
     protected:
       Animation *parent;
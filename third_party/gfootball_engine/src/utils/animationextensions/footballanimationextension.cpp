@@ -17,6 +17,7 @@
 
 #include "footballanimationextension.hpp"
 #include "../animation.hpp"
+#include "../animationcache.hpp"
 
 #include "../../base/utils.hpp"
 
@@ -157,6 +158,30 @@ namespace blunted {
     fprintf(file, "%s\n", line.c_str());
   }
 
+  void FootballAnimationExtension::ProcessCache(AnimationCache *cache) {
+    int count = animation.size();
+    if (!cache->ProcessSize(count)) return;
+    if (cache->IsLoading()) {
+      animation.clear();
+      for (int i = 0; i < count && !cache->Failed(); i++) {
+        int frame = 0;
+        cache->Process(frame);
+        FootballKeyFrame &keyFrame = animation[frame];
+        cache->Process(keyFrame.orientation);
+        cache->Process(keyFrame.position);
+        cache->Process(keyFrame.power);
+      }
+    } else {
+      for (auto &keyFrame : animation) {
+        int frame = keyFrame.first;
+        cache->Process(frame);
+        cache->Process(keyFrame.second.orientation);
+        cache->Process(keyFrame.second.position);
+        cache->Process(keyFrame.second.power);
+      }
+    }
+  }
+
   bool FootballAnimationExtension::GetFirstTouch(Vector3 &position, int &frame) {
     if (!animation.empty()) {
       position = animation.begin()->second.position;
@@ -44,6 +44,7 @@ namespace blunted {
 
       virtual void Load(std::vector<std::string> &tokenizedLine);
       virtual void Save(FILE *file);
+      virtual void ProcessCache(AnimationCache *cache);
 
       virtual bool GetFirstTouch(Vector3 &position, int &frame);
       int GetTouchCount() const;
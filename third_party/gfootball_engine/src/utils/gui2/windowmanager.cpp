@@ -89,6 +89,9 @@ namespace blunted {
   }
 
   void Gui2WindowManager::Exit() {
+    // the current page is a child of root, delete it before root takes it down
+    pagePath->Clear();
+
     for (unsigned int i = 0; i < pendingDelete.size(); i++) {
       pendingDelete[i]->Exit();
       delete pendingDelete[i];